@@ -25,6 +25,8 @@
 //   Download (GPU→CPU):
 //     GPU timestamps bracketing the copy commands on the copy/transfer queue.
 //     Accurate on all GPU types since the DMA engine controls the transfer.
+//     Batches are kept in flight through a ring of command buffers signalling
+//     a timeline semaphore, so the queue never drains between batches.
 //
 //   Upload (CPU→GPU) - Discrete GPUs:
 //     CPU round-trip timing. Records: upload + barrier + download from same
@@ -56,6 +58,11 @@
 //   Back-to-back timestamp pairs with no work between them.
 //   Measures minimum per-command dispatch overhead of the copy/transfer queue.
 //
+// Queue Scaling (optional):
+//   One fixed transfer split into n slices on n queues at once, n = 1..every
+//   queue of the transfer family (optionally compute/graphics queues too).
+//   Aggregate = wall clock over the fan-out; per queue = its own timestamps.
+//
 // CROSS-API EQUIVALENCES
 // ─────────────────────────────────────────────────────────────────────────────
 //   Vulkan                           D3D12
@@ -71,6 +78,7 @@
 //   VK_MEMORY_PROPERTY_DEVICE_LOCAL  D3D12_HEAP_TYPE_DEFAULT
 //   HOST_VISIBLE + HOST_CACHED       D3D12_HEAP_TYPE_READBACK
 //   vkQueueSubmit + vkWaitForFences  ExecuteCommandLists + Signal/Wait fence
+//   Timeline semaphore value         ID3D12Fence value (Signal/SetEventOnCompletion)
 //   Dual transfer queues (bidir)     2 × COPY queues (bidir)
 //
 // D3D12 QUEUE DIVERGENCE NOTES
@@ -99,10 +107,25 @@
 // - Results graphs and charts with standard comparisons
 // - CSV export
 // - VRAM-aware buffer sizing
-// - VRAM integrity scanning (multiple test patterns, error clustering)
+// - VRAM integrity scanning (multiple test patterns, error clustering,
+//   in-place GPU write/verify kernels, or pipelined host generation /
+//   DMA / verification as the fallback)
 // - eGPU auto-detection (Thunderbolt/USB4/USB via device tree)
 // - Integrated GPU (APU) proper detection - no fake PCIe reporting
 // - Actual PCIe link detection via sysfs
+// - Concurrent multi-GPU sessions (lockstep phases, per-GPU + aggregate)
+// - GPU-to-GPU copy matrix (dma-buf peer import vs. host-staged)
+// - Imported host memory (VK_EXT_external_memory_host, 4K/THP/HugeTLB pages)
+// - NUMA-local thread/staging placement with optional remote-node comparison
+// - Resizable BAR detection and CPU direct VRAM write/read vs. DMA
+// - Compute-shader (SM) copies vs. DMA copy engines over a workgroup sweep
+// - Scatter/gather copies: N regions in one command vs. N commands
+// - Buffer <-> image copies over formats, tilings and mip/array layouts
+// - Soak mode: hours of sustained traffic with step-change / degradation detection
+// - Latency percentiles (p50 .. p99.99) from mergeable log-linear histograms
+// - Adaptive sampling: batches sized to a target duration, run until the 95% bootstrap CI converges
+// - Calibrated CPU/GPU timestamps: uploads timed on the host timeline, with drift tracking
+// - Per-copy timestamps inside batches: first-copy (cold) vs. steady-state bandwidth
 // - System RAM detection via /proc/meminfo + dmidecode
 // - Native UTF-8 (no conversion needed on Linux)
 // ============================================================================
@@ -125,6 +148,8 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
@@ -139,14 +164,27 @@
 #include <cinttypes>
 #include <cstring>
 #include <climits>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
 
 // Linux-specific headers for hardware detection
 #include <unistd.h>
 #include <dirent.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <pthread.h>
+#include <sched.h>
 #include <sys/utsname.h>
 
+// x86 SIMD for the VRAM scan comparator (selected at runtime via CPUID)
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define VRAM_COMPARE_X86 1
+#endif
+
 // ImGui headers (downloaded by CMake FetchContent)
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
@@ -178,9 +216,72 @@ namespace Constants {
     constexpr uint32_t FENCE_WAIT_TIMEOUT_MS = 8000;
     constexpr int MAX_FENCE_RETRIES = 3;
     constexpr uint32_t GLOBAL_BENCHMARK_TIMEOUT_MS = 300000;
+    constexpr uint32_t BENCH_SUBMIT_RING_SIZE = 4;  // Bandwidth batches in flight (timeline engine)
     
     constexpr double VRAM_SAFETY_MARGIN = 0.8;
+    constexpr size_t VRAM_SCAN_SLICE_SIZE = 32ull * 1024 * 1024;  // Pipeline step granularity
+    constexpr size_t VRAM_SCAN_PIPELINE_SLOTS = 3;                // Triple-buffered staging
+    constexpr size_t VRAM_ERROR_CLUSTER_DWORDS = 256;             // Merge errors within this range
+    constexpr size_t VRAM_SCAN_MIN_WORKER_DWORDS = 64 * 1024;     // 256 KB minimum per host worker task
+    constexpr uint32_t VRAM_RANDOM_SEED = 0xDEADBEEF;             // Random pattern seed (+ iteration)
+    constexpr uint32_t VRAM_SCAN_GPU_MAX_ERRORS = 4096;           // Mismatch records per pass (GPU verify)
+    constexpr uint32_t VRAM_SCAN_GPU_WORKGROUP = 256;             // Must match LocalSize in g_vramPatternSPIRV
+    constexpr size_t VRAM_SCAN_GPU_WINDOW_SIZE = 256ull * 1024 * 1024;  // Max bytes per storage descriptor
     constexpr size_t MIN_BANDWIDTH_SIZE = 16ull * 1024 * 1024;
+    constexpr size_t SWEEP_MIN_SIZE = 4ull * 1024;                    // Transfer-size sweep: 4 KB ..
+    constexpr size_t SWEEP_MAX_SIZE = 1024ull * 1024 * 1024;          // .. 1 GB, doubling
+    constexpr size_t SWEEP_BYTES_PER_POINT = 4ull * 1024 * 1024 * 1024;  // Large sizes run fewer batches
+    constexpr int SWEEP_MIN_BATCHES = 4;
+    constexpr uint32_t MAX_BENCH_QUEUES_PER_FAMILY = 16;              // Queues opened per family
+    constexpr int QUEUE_SCALING_MAX_BATCHES = 16;
+    constexpr size_t QUEUE_SCALING_SLICE_ALIGN = 64 * 1024;           // Per-queue slice granularity
+    constexpr double QUEUE_SCALING_SATURATION = 0.95;                 // "Saturated" = 95% of best aggregate
+    constexpr int PEER_COPY_MAX_BATCHES = 16;
+    constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;                // x86-64 PMD page (THP and default hugetlbfs)
+    constexpr size_t REBAR_MIN_HEAP_SIZE = 256ull * 1024 * 1024;       // Legacy BAR window; anything bigger is ReBAR
+    constexpr int DIRECT_ACCESS_MAX_THREADS = 8;
+    constexpr int DIRECT_ACCESS_MAX_PASSES = 8;
+    constexpr uint32_t COMPUTE_COPY_WORKGROUP = 256;                  // Must match LocalSize in g_computeCopySPIRV
+    constexpr uint32_t COMPUTE_COPY_MAX_GROUPS = 4096;                // Sweep: 1, 4, 16 .. 4096 workgroups
+    constexpr int COMPUTE_COPY_MAX_PASSES = 8;
+    constexpr double COMPUTE_COPY_SATURATION = 0.95;                  // "Saturated" = 95% of best bandwidth
+    constexpr int DEFAULT_SCATTER_REGIONS = 4096;                     // Sub-buffer updates per copy batch
+    constexpr int DEFAULT_SCATTER_REGION_SIZE = 4096;
+    constexpr int SCATTER_MAX_REGIONS = 65536;
+    constexpr int SCATTER_MAX_REGION_SIZE = 4 * 1024 * 1024;
+    constexpr int SCATTER_MAX_BATCHES = 16;
+    constexpr uint32_t IMAGE_COPY_MAX_EXTENT = 4096;                  // Largest 2D image side in the image copy test
+    constexpr uint32_t IMAGE_COPY_ARRAY_LAYERS = 16;                  // Array layout: 16 layers at 1/4 the side
+    constexpr int IMAGE_COPY_MAX_BATCHES = 16;
+    constexpr int PER_COPY_MAX_BATCHES = 64;    // Per-copy timing: serial batches per direction
+    constexpr int DEFAULT_SOAK_MINUTES = 30;
+    constexpr int SOAK_MAX_MINUTES = 24 * 60;
+    constexpr size_t SOAK_SERIES_CAPACITY = 1800;                     // Points kept; resolution halves when full
+    constexpr double SOAK_BASELINE_SECONDS = 60.0;                    // Reference window: samples after the first one
+    constexpr double SOAK_FAST_SECONDS = 5.0;                         // Short / long EWMA time constants
+    constexpr double SOAK_SLOW_SECONDS = 60.0;
+    constexpr double SOAK_STEP_THRESHOLD = 0.10;                      // Short vs. long average differs by 10% ...
+    constexpr int SOAK_STEP_HOLD_SECONDS = 5;                         // ... for 5 s in a row = step change
+    constexpr double SOAK_DEGRADATION_STEP = 0.05;                    // Flag every further 5% below baseline
+    constexpr int SOAK_LINK_POLL_SECONDS = 5;
+    constexpr size_t SOAK_MAX_EVENTS = 64;
+
+    // Adaptive sampling (bandwidth tests)
+    constexpr double DEFAULT_ADAPTIVE_CI_PERCENT = 2.0;  // Target 95% CI width, % of the mean
+    constexpr int    DEFAULT_ADAPTIVE_BUDGET_SEC = 30;   // Per test
+    constexpr int    ADAPTIVE_MAX_BUDGET_SEC = 600;
+    constexpr double ADAPTIVE_BATCH_MS = 50.0;           // Target batch duration for copy auto-sizing
+    constexpr int    ADAPTIVE_MAX_COPIES = 256;
+    constexpr int    ADAPTIVE_MIN_SAMPLES = 16;          // Before the first convergence check
+    constexpr int    ADAPTIVE_MAX_SAMPLES = 4096;
+    constexpr int    ADAPTIVE_BOOTSTRAP_RESAMPLES = 1000;
+    constexpr double ADAPTIVE_OUTLIER_Z = 3.5;           // Modified z-score cut-off (Iglewicz & Hoaglin)
+
+    // Calibrated timestamps (VK_EXT_calibrated_timestamps)
+    constexpr int      CALIBRATION_ATTEMPTS = 8;             // Per sample; the tightest pair is kept
+    constexpr uint64_t CALIBRATION_MIN_SPAN_NS = 100000000;  // Before the clock rate is fitted
+    constexpr uint64_t CALIBRATION_INTERVAL_NS = 1000000000; // Re-sample during long tests
+    constexpr double   CALIBRATION_SLACK_NS = 20000.0;       // Window tolerance beyond the driver's deviation
     
     constexpr double EGPU_BANDWIDTH_THRESHOLD = 5.0;
     constexpr double TB3_MAX_BANDWIDTH = 3.5;
@@ -237,6 +338,192 @@ static const uint32_t g_memoryLatencySPIRV[] = {
 };
 static const size_t g_memoryLatencySPIRVSize = sizeof(g_memoryLatencySPIRV);
 
+// Embedded SPIR-V compute shader for the GPU-side VRAM scan (write / verify pattern).
+// One module, two pipelines: specialization constant 0 (VERIFY) selects the mode.
+// Equivalent GLSL:
+//
+//   layout(local_size_x = 256) in;
+//   layout(constant_id = 0) const bool VERIFY = false;
+//   layout(push_constant) uniform Params {
+//       uint kind;       // 0 = constant, 1 = address, 2 = random
+//       uint value;      // constant value, or seed for random
+//       uint baseIndex;  // chunk dword index of data[0]
+//       uint count;      // dwords in this window
+//       uint maxErrors;  // capacity of records[] in (index, expected, actual) triples
+//   } params;
+//   layout(std430, binding = 0) buffer Data   { uint data[]; };
+//   layout(std430, binding = 1) buffer Errors { uint errorCount; uint records[]; };
+//
+//   void main() {
+//       uint stride = gl_NumWorkGroups.x * 256u;
+//       for (uint i = gl_GlobalInvocationID.x; i < params.count; i += stride) {
+//           uint index = params.baseIndex + i;
+//           uint h = index ^ params.value;            // lowbias32 hash
+//           h ^= h >> 16; h *= 0x7feb352du;
+//           h ^= h >> 15; h *= 0x846ca68bu;
+//           h ^= h >> 16;
+//           uint expected = params.kind == 2u ? h : (params.kind == 1u ? index : params.value);
+//           if (!VERIFY) {
+//               data[i] = expected;
+//           } else {
+//               uint actual = data[i];
+//               if (actual != expected) {
+//                   uint slot = atomicAdd(errorCount, 1u);
+//                   if (slot < params.maxErrors) {
+//                       records[slot * 3u + 0u] = index;
+//                       records[slot * 3u + 1u] = expected;
+//                       records[slot * 3u + 2u] = actual;
+//                   }
+//               }
+//           }
+//       }
+//   }
+static const uint32_t g_vramPatternSPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000062, 0x00000000, 0x00020011, 0x00000001, 0x0003000e,
+    0x00000000, 0x00000001, 0x0007000f, 0x00000005, 0x00000001, 0x6e69616d, 0x00000000, 0x00000002,
+    0x00000003, 0x00060010, 0x00000001, 0x00000011, 0x00000100, 0x00000001, 0x00000001, 0x00030003,
+    0x00000002, 0x000001c2, 0x00040005, 0x00000001, 0x6e69616d, 0x00000000, 0x00040005, 0x00000004,
+    0x61726150, 0x0000736d, 0x00050006, 0x00000004, 0x00000000, 0x646e696b, 0x00000000, 0x00050006,
+    0x00000004, 0x00000001, 0x756c6176, 0x00000065, 0x00060006, 0x00000004, 0x00000002, 0x65736162,
+    0x65646e49, 0x00000078, 0x00050006, 0x00000004, 0x00000003, 0x6e756f63, 0x00000074, 0x00060006,
+    0x00000004, 0x00000004, 0x4578616d, 0x726f7272, 0x00000073, 0x00040005, 0x00000005, 0x61726170,
+    0x0000736d, 0x00040005, 0x00000006, 0x61746144, 0x00000000, 0x00050006, 0x00000006, 0x00000000,
+    0x61746164, 0x00000000, 0x00030005, 0x00000007, 0x00000000, 0x00040005, 0x00000008, 0x6f727245,
+    0x00007372, 0x00060006, 0x00000008, 0x00000000, 0x6f727265, 0x756f4372, 0x0000746e, 0x00050006,
+    0x00000008, 0x00000001, 0x6f636572, 0x00736472, 0x00030005, 0x00000009, 0x00000000, 0x00040005,
+    0x0000000a, 0x49524556, 0x00005946, 0x00030005, 0x0000000b, 0x00000069, 0x00040047, 0x00000002,
+    0x0000000b, 0x0000001c, 0x00040047, 0x00000003, 0x0000000b, 0x00000018, 0x00040047, 0x0000000a,
+    0x00000001, 0x00000000, 0x00030047, 0x00000004, 0x00000002, 0x00050048, 0x00000004, 0x00000000,
+    0x00000023, 0x00000000, 0x00050048, 0x00000004, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
+    0x00000004, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000004, 0x00000003, 0x00000023,
+    0x0000000c, 0x00050048, 0x00000004, 0x00000004, 0x00000023, 0x00000010, 0x00040047, 0x0000000c,
+    0x00000006, 0x00000004, 0x00030047, 0x00000006, 0x00000003, 0x00050048, 0x00000006, 0x00000000,
+    0x00000023, 0x00000000, 0x00040047, 0x00000007, 0x00000022, 0x00000000, 0x00040047, 0x00000007,
+    0x00000021, 0x00000000, 0x00040047, 0x0000000d, 0x00000006, 0x00000004, 0x00030047, 0x00000008,
+    0x00000003, 0x00050048, 0x00000008, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000008,
+    0x00000001, 0x00000023, 0x00000004, 0x00040047, 0x00000009, 0x00000022, 0x00000000, 0x00040047,
+    0x00000009, 0x00000021, 0x00000001, 0x00020013, 0x0000000e, 0x00030021, 0x0000000f, 0x0000000e,
+    0x00020014, 0x00000010, 0x00040015, 0x00000011, 0x00000020, 0x00000000, 0x00040015, 0x00000012,
+    0x00000020, 0x00000001, 0x00040017, 0x00000013, 0x00000011, 0x00000003, 0x00040020, 0x00000014,
+    0x00000001, 0x00000013, 0x0004003b, 0x00000014, 0x00000002, 0x00000001, 0x0004003b, 0x00000014,
+    0x00000003, 0x00000001, 0x00040020, 0x00000015, 0x00000007, 0x00000011, 0x0007001e, 0x00000004,
+    0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00040020, 0x00000016, 0x00000009,
+    0x00000004, 0x0004003b, 0x00000016, 0x00000005, 0x00000009, 0x00040020, 0x00000017, 0x00000009,
+    0x00000011, 0x0003001d, 0x0000000c, 0x00000011, 0x0003001e, 0x00000006, 0x0000000c, 0x00040020,
+    0x00000018, 0x00000002, 0x00000006, 0x0004003b, 0x00000018, 0x00000007, 0x00000002, 0x0003001d,
+    0x0000000d, 0x00000011, 0x0004001e, 0x00000008, 0x00000011, 0x0000000d, 0x00040020, 0x00000019,
+    0x00000002, 0x00000008, 0x0004003b, 0x00000019, 0x00000009, 0x00000002, 0x00040020, 0x0000001a,
+    0x00000002, 0x00000011, 0x0004002b, 0x00000012, 0x0000001b, 0x00000000, 0x0004002b, 0x00000012,
+    0x0000001c, 0x00000001, 0x0004002b, 0x00000012, 0x0000001d, 0x00000002, 0x0004002b, 0x00000012,
+    0x0000001e, 0x00000003, 0x0004002b, 0x00000012, 0x0000001f, 0x00000004, 0x0004002b, 0x00000011,
+    0x00000020, 0x00000000, 0x0004002b, 0x00000011, 0x00000021, 0x00000001, 0x0004002b, 0x00000011,
+    0x00000022, 0x00000002, 0x0004002b, 0x00000011, 0x00000023, 0x00000003, 0x0004002b, 0x00000011,
+    0x00000024, 0x0000000f, 0x0004002b, 0x00000011, 0x00000025, 0x00000010, 0x0004002b, 0x00000011,
+    0x00000026, 0x00000100, 0x0004002b, 0x00000011, 0x00000027, 0x7feb352d, 0x0004002b, 0x00000011,
+    0x00000028, 0x846ca68b, 0x00030031, 0x00000010, 0x0000000a, 0x00050036, 0x0000000e, 0x00000001,
+    0x00000000, 0x0000000f, 0x000200f8, 0x00000029, 0x0004003b, 0x00000015, 0x0000000b, 0x00000007,
+    0x0004003d, 0x00000013, 0x0000002a, 0x00000002, 0x00050051, 0x00000011, 0x0000002b, 0x0000002a,
+    0x00000000, 0x0004003d, 0x00000013, 0x0000002c, 0x00000003, 0x00050051, 0x00000011, 0x0000002d,
+    0x0000002c, 0x00000000, 0x00050084, 0x00000011, 0x0000002e, 0x0000002d, 0x00000026, 0x00050041,
+    0x00000017, 0x0000002f, 0x00000005, 0x0000001b, 0x0004003d, 0x00000011, 0x00000030, 0x0000002f,
+    0x00050041, 0x00000017, 0x00000031, 0x00000005, 0x0000001c, 0x0004003d, 0x00000011, 0x00000032,
+    0x00000031, 0x00050041, 0x00000017, 0x00000033, 0x00000005, 0x0000001d, 0x0004003d, 0x00000011,
+    0x00000034, 0x00000033, 0x00050041, 0x00000017, 0x00000035, 0x00000005, 0x0000001e, 0x0004003d,
+    0x00000011, 0x00000036, 0x00000035, 0x00050041, 0x00000017, 0x00000037, 0x00000005, 0x0000001f,
+    0x0004003d, 0x00000011, 0x00000038, 0x00000037, 0x000500aa, 0x00000010, 0x00000039, 0x00000030,
+    0x00000021, 0x000500aa, 0x00000010, 0x0000003a, 0x00000030, 0x00000022, 0x0003003e, 0x0000000b,
+    0x0000002b, 0x000200f9, 0x0000003b, 0x000200f8, 0x0000003b, 0x000400f6, 0x0000003c, 0x0000003d,
+    0x00000000, 0x000200f9, 0x0000003e, 0x000200f8, 0x0000003e, 0x0004003d, 0x00000011, 0x0000003f,
+    0x0000000b, 0x000500b0, 0x00000010, 0x00000040, 0x0000003f, 0x00000036, 0x000400fa, 0x00000040,
+    0x00000041, 0x0000003c, 0x000200f8, 0x00000041, 0x00050080, 0x00000011, 0x00000042, 0x00000034,
+    0x0000003f, 0x000500c6, 0x00000011, 0x00000043, 0x00000042, 0x00000032, 0x000500c2, 0x00000011,
+    0x00000044, 0x00000043, 0x00000025, 0x000500c6, 0x00000011, 0x00000045, 0x00000043, 0x00000044,
+    0x00050084, 0x00000011, 0x00000046, 0x00000045, 0x00000027, 0x000500c2, 0x00000011, 0x00000047,
+    0x00000046, 0x00000024, 0x000500c6, 0x00000011, 0x00000048, 0x00000046, 0x00000047, 0x00050084,
+    0x00000011, 0x00000049, 0x00000048, 0x00000028, 0x000500c2, 0x00000011, 0x0000004a, 0x00000049,
+    0x00000025, 0x000500c6, 0x00000011, 0x0000004b, 0x00000049, 0x0000004a, 0x000600a9, 0x00000011,
+    0x0000004c, 0x00000039, 0x00000042, 0x00000032, 0x000600a9, 0x00000011, 0x0000004d, 0x0000003a,
+    0x0000004b, 0x0000004c, 0x00060041, 0x0000001a, 0x0000004e, 0x00000007, 0x0000001b, 0x0000003f,
+    0x000300f7, 0x0000004f, 0x00000000, 0x000400fa, 0x0000000a, 0x00000050, 0x00000051, 0x000200f8,
+    0x00000051, 0x0003003e, 0x0000004e, 0x0000004d, 0x000200f9, 0x0000004f, 0x000200f8, 0x00000050,
+    0x0004003d, 0x00000011, 0x00000052, 0x0000004e, 0x000500ab, 0x00000010, 0x00000053, 0x00000052,
+    0x0000004d, 0x000300f7, 0x00000054, 0x00000000, 0x000400fa, 0x00000053, 0x00000055, 0x00000054,
+    0x000200f8, 0x00000055, 0x00050041, 0x0000001a, 0x00000056, 0x00000009, 0x0000001b, 0x000700ea,
+    0x00000011, 0x00000057, 0x00000056, 0x00000021, 0x00000020, 0x00000021, 0x000500b0, 0x00000010,
+    0x00000058, 0x00000057, 0x00000038, 0x000300f7, 0x00000059, 0x00000000, 0x000400fa, 0x00000058,
+    0x0000005a, 0x00000059, 0x000200f8, 0x0000005a, 0x00050084, 0x00000011, 0x0000005b, 0x00000057,
+    0x00000023, 0x00060041, 0x0000001a, 0x0000005c, 0x00000009, 0x0000001c, 0x0000005b, 0x0003003e,
+    0x0000005c, 0x00000042, 0x00050080, 0x00000011, 0x0000005d, 0x0000005b, 0x00000021, 0x00060041,
+    0x0000001a, 0x0000005e, 0x00000009, 0x0000001c, 0x0000005d, 0x0003003e, 0x0000005e, 0x0000004d,
+    0x00050080, 0x00000011, 0x0000005f, 0x0000005b, 0x00000022, 0x00060041, 0x0000001a, 0x00000060,
+    0x00000009, 0x0000001c, 0x0000005f, 0x0003003e, 0x00000060, 0x00000052, 0x000200f9, 0x00000059,
+    0x000200f8, 0x00000059, 0x000200f9, 0x00000054, 0x000200f8, 0x00000054, 0x000200f9, 0x0000004f,
+    0x000200f8, 0x0000004f, 0x000200f9, 0x0000003d, 0x000200f8, 0x0000003d, 0x00050080, 0x00000011,
+    0x00000061, 0x0000003f, 0x0000002e, 0x0003003e, 0x0000000b, 0x00000061, 0x000200f9, 0x0000003b,
+    0x000200f8, 0x0000003c, 0x000100fd, 0x00010038,
+};
+static const size_t g_vramPatternSPIRVSize = sizeof(g_vramPatternSPIRV);
+
+// Embedded SPIR-V compute shader for the compute-copy benchmark (SM copy vs. DMA).
+// Equivalent GLSL:
+//
+//   layout(local_size_x = 256) in;
+//   layout(push_constant) uniform Params { uint count; } params;  // uvec4 elements
+//   layout(std430, binding = 0) readonly buffer Src  { uvec4 src[]; };
+//   layout(std430, binding = 1) writeonly buffer Dst { uvec4 dst[]; };
+//
+//   void main() {
+//       uint stride = gl_NumWorkGroups.x * 256u;
+//       for (uint i = gl_GlobalInvocationID.x; i < params.count; i += stride) {
+//           dst[i] = src[i];
+//       }
+//   }
+static const uint32_t g_computeCopySPIRV[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000030, 0x00000000, 0x00020011, 0x00000001, 0x0003000e,
+    0x00000000, 0x00000001, 0x0007000f, 0x00000005, 0x00000001, 0x6e69616d, 0x00000000, 0x00000002,
+    0x00000003, 0x00060010, 0x00000001, 0x00000011, 0x00000100, 0x00000001, 0x00000001, 0x00030003,
+    0x00000002, 0x000001c2, 0x00040005, 0x00000001, 0x6e69616d, 0x00000000, 0x00040005, 0x00000004,
+    0x61726150, 0x0000736d, 0x00050006, 0x00000004, 0x00000000, 0x6e756f63, 0x00000074, 0x00040005,
+    0x00000005, 0x61726170, 0x0000736d, 0x00030005, 0x00000006, 0x00637253, 0x00040006, 0x00000006,
+    0x00000000, 0x00637273, 0x00030005, 0x00000007, 0x00000000, 0x00030005, 0x00000008, 0x00747344,
+    0x00040006, 0x00000008, 0x00000000, 0x00747364, 0x00030005, 0x00000009, 0x00000000, 0x00030005,
+    0x0000000a, 0x00000069, 0x00040047, 0x00000002, 0x0000000b, 0x0000001c, 0x00040047, 0x00000003,
+    0x0000000b, 0x00000018, 0x00030047, 0x00000004, 0x00000002, 0x00050048, 0x00000004, 0x00000000,
+    0x00000023, 0x00000000, 0x00040047, 0x0000000b, 0x00000006, 0x00000010, 0x00030047, 0x00000006,
+    0x00000003, 0x00040048, 0x00000006, 0x00000000, 0x00000018, 0x00050048, 0x00000006, 0x00000000,
+    0x00000023, 0x00000000, 0x00040047, 0x00000007, 0x00000022, 0x00000000, 0x00040047, 0x00000007,
+    0x00000021, 0x00000000, 0x00040047, 0x0000000c, 0x00000006, 0x00000010, 0x00030047, 0x00000008,
+    0x00000003, 0x00040048, 0x00000008, 0x00000000, 0x00000019, 0x00050048, 0x00000008, 0x00000000,
+    0x00000023, 0x00000000, 0x00040047, 0x00000009, 0x00000022, 0x00000000, 0x00040047, 0x00000009,
+    0x00000021, 0x00000001, 0x00020013, 0x0000000d, 0x00030021, 0x0000000e, 0x0000000d, 0x00020014,
+    0x0000000f, 0x00040015, 0x00000010, 0x00000020, 0x00000000, 0x00040015, 0x00000011, 0x00000020,
+    0x00000001, 0x00040017, 0x00000012, 0x00000010, 0x00000003, 0x00040017, 0x00000013, 0x00000010,
+    0x00000004, 0x00040020, 0x00000014, 0x00000001, 0x00000012, 0x0004003b, 0x00000014, 0x00000002,
+    0x00000001, 0x0004003b, 0x00000014, 0x00000003, 0x00000001, 0x00040020, 0x00000015, 0x00000007,
+    0x00000010, 0x0003001e, 0x00000004, 0x00000010, 0x00040020, 0x00000016, 0x00000009, 0x00000004,
+    0x0004003b, 0x00000016, 0x00000005, 0x00000009, 0x00040020, 0x00000017, 0x00000009, 0x00000010,
+    0x0003001d, 0x0000000b, 0x00000013, 0x0003001e, 0x00000006, 0x0000000b, 0x00040020, 0x00000018,
+    0x00000002, 0x00000006, 0x0004003b, 0x00000018, 0x00000007, 0x00000002, 0x0003001d, 0x0000000c,
+    0x00000013, 0x0003001e, 0x00000008, 0x0000000c, 0x00040020, 0x00000019, 0x00000002, 0x00000008,
+    0x0004003b, 0x00000019, 0x00000009, 0x00000002, 0x00040020, 0x0000001a, 0x00000002, 0x00000013,
+    0x0004002b, 0x00000011, 0x0000001b, 0x00000000, 0x0004002b, 0x00000010, 0x0000001c, 0x00000100,
+    0x00050036, 0x0000000d, 0x00000001, 0x00000000, 0x0000000e, 0x000200f8, 0x0000001d, 0x0004003b,
+    0x00000015, 0x0000000a, 0x00000007, 0x0004003d, 0x00000012, 0x0000001e, 0x00000002, 0x00050051,
+    0x00000010, 0x0000001f, 0x0000001e, 0x00000000, 0x0004003d, 0x00000012, 0x00000020, 0x00000003,
+    0x00050051, 0x00000010, 0x00000021, 0x00000020, 0x00000000, 0x00050084, 0x00000010, 0x00000022,
+    0x00000021, 0x0000001c, 0x00050041, 0x00000017, 0x00000023, 0x00000005, 0x0000001b, 0x0004003d,
+    0x00000010, 0x00000024, 0x00000023, 0x0003003e, 0x0000000a, 0x0000001f, 0x000200f9, 0x00000025,
+    0x000200f8, 0x00000025, 0x000400f6, 0x00000026, 0x00000027, 0x00000000, 0x000200f9, 0x00000028,
+    0x000200f8, 0x00000028, 0x0004003d, 0x00000010, 0x00000029, 0x0000000a, 0x000500b0, 0x0000000f,
+    0x0000002a, 0x00000029, 0x00000024, 0x000400fa, 0x0000002a, 0x0000002b, 0x00000026, 0x000200f8,
+    0x0000002b, 0x00060041, 0x0000001a, 0x0000002c, 0x00000007, 0x0000001b, 0x00000029, 0x0004003d,
+    0x00000013, 0x0000002d, 0x0000002c, 0x00060041, 0x0000001a, 0x0000002e, 0x00000009, 0x0000001b,
+    0x00000029, 0x0003003e, 0x0000002e, 0x0000002d, 0x000200f9, 0x00000027, 0x000200f8, 0x00000027,
+    0x00050080, 0x00000010, 0x0000002f, 0x00000029, 0x00000022, 0x0003003e, 0x0000000a, 0x0000002f,
+    0x000200f9, 0x00000025, 0x000200f8, 0x00000026, 0x000100fd, 0x00010038,
+};
+static const size_t g_computeCopySPIRVSize = sizeof(g_computeCopySPIRV);
+
 // ============================================================================
 // DATA STRUCTURES
 // ============================================================================
@@ -263,6 +550,12 @@ struct GPUInfo {
     int         thunderboltVersion = 0;
     std::string externalConnectionType;
     
+    size_t      cpuVisibleVRAM = 0;    // Largest DEVICE_LOCAL heap with a HOST_VISIBLE type (BAR size)
+    bool        hasReBAR = false;      // Discrete GPU whose CPU-visible VRAM exceeds the 256 MB window
+    
+    int         numaNode = -1;         // sysfs numa_node (-1: single node or unknown)
+    std::string localCpuList;          // sysfs local_cpulist, e.g. "0-15,32-47"
+    
     // Vulkan physical device handle for reliable selection
     VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
 };
@@ -338,6 +631,89 @@ inline double CalculateRealisticPCIeBandwidth(int gen, int lanes) {
     return (gtPerSec * lanes * efficiency) / 8.0;
 }
 
+// Log-linear latency histogram (HDR-histogram layout). Values are stored in
+// thousandths of the result unit: exact below 256, then 128 linear buckets
+// per power of two (< 0.8% relative error) up to 2^40. Counts are allocated
+// on the first sample and never grow, and histograms of the same unit merge
+// by adding counts, so percentiles stay exact across aggregated runs.
+struct LatencyHistogram {
+    static constexpr int      SUB_BITS = 8;
+    static constexpr uint64_t SUB_COUNT = 1ull << SUB_BITS;       // Exact region / bucket group size
+    static constexpr uint64_t HALF_COUNT = SUB_COUNT / 2;
+    static constexpr int      MAX_BITS = 40;                      // Larger values land in the top bucket
+    static constexpr size_t   BUCKETS = SUB_COUNT + (MAX_BITS - SUB_BITS) * HALF_COUNT;
+    static constexpr double   SCALE = 1000.0;                     // Stored units per result unit
+
+    std::vector<uint32_t> counts;  // BUCKETS entries once anything was recorded
+    uint64_t total = 0;
+    double   minValue = 0, maxValue = 0, sum = 0;
+
+    static size_t BucketIndex(uint64_t v) {
+        v = std::min<uint64_t>(v, (1ull << MAX_BITS) - 1);
+        if (v < SUB_COUNT) return static_cast<size_t>(v);
+        const int exponent = (63 - __builtin_clzll(v)) - (SUB_BITS - 1);  // v >> exponent in [HALF, SUB)
+        return static_cast<size_t>(SUB_COUNT + (exponent - 1) * HALF_COUNT + ((v >> exponent) - HALF_COUNT));
+    }
+
+    // Midpoint of a bucket, in stored units
+    static double BucketValue(size_t index) {
+        if (index < SUB_COUNT) return static_cast<double>(index);
+        const size_t j = index - SUB_COUNT;
+        const int exponent = static_cast<int>(j / HALF_COUNT) + 1;
+        const double low = static_cast<double>((j % HALF_COUNT + HALF_COUNT) << exponent);
+        return low + static_cast<double>(1ull << exponent) / 2.0;
+    }
+
+    bool empty() const { return total == 0; }
+
+    void Record(double value) {
+        if (!(value >= 0)) return;
+        if (counts.empty()) counts.assign(BUCKETS, 0);
+        counts[BucketIndex(static_cast<uint64_t>(std::llround(value * SCALE)))]++;
+        minValue = total == 0 ? value : std::min(minValue, value);
+        maxValue = total == 0 ? value : std::max(maxValue, value);
+        sum += value;
+        total++;
+    }
+
+    void Merge(const LatencyHistogram& other) {
+        if (other.empty()) return;
+        if (counts.empty()) counts.assign(BUCKETS, 0);
+        for (size_t i = 0; i < BUCKETS; ++i) counts[i] += other.counts[i];
+        minValue = total == 0 ? other.minValue : std::min(minValue, other.minValue);
+        maxValue = total == 0 ? other.maxValue : std::max(maxValue, other.maxValue);
+        sum += other.sum;
+        total += other.total;
+    }
+
+    // Value at or below which `percentile` % of the samples fall
+    double Percentile(double percentile) const {
+        if (empty()) return 0.0;
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * total)));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            seen += counts[i];
+            if (seen >= rank) return std::clamp(BucketValue(i) / SCALE, minValue, maxValue);
+        }
+        return maxValue;
+    }
+};
+
+// Percentiles shown for latency results
+static const double g_latencyPercentiles[] = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+static const char* const g_latencyPercentileLabels[] = { "p50", "p90", "p99", "p99.9", "p99.99" };
+constexpr int LATENCY_PERCENTILE_COUNT = 5;
+
+// Calibrated-timestamp breakdown of CPU-timed round trips, averaged over the
+// accepted samples (microseconds on the CLOCK_MONOTONIC_RAW timeline)
+struct HostTimeline {
+    double submitToStartUs = 0;  // CPU submit -> first GPU timestamp
+    double transferUs = 0;       // Timed transfer on the GPU
+    double wakeupUs = 0;         // Last GPU timestamp -> CPU back from the wait
+    int    samples = 0;
+    int    rejected = 0;         // GPU timestamps outside the CPU submit/wake-up window
+};
+
 struct BenchmarkResult {
     std::string       testName;
     double            minValue = 0;
@@ -345,6 +721,191 @@ struct BenchmarkResult {
     double            maxValue = 0;
     std::string       unit;
     std::vector<double> samples;
+    LatencyHistogram  histogram;  // Latency tests: every sample, for percentiles
+    double            ciLow = 0;  // Bandwidth tests: 95% bootstrap CI of avgValue (ciHigh 0 = none)
+    double            ciHigh = 0;
+    int               rejectedSamples = 0;  // Outliers dropped by adaptive sampling
+    HostTimeline      timeline;   // CPU->GPU with calibrated timestamps
+};
+
+// Transfer-size sweep: average GB/s per size (0 = not measured)
+struct SizeSweepResult {
+    std::vector<double> sizes;  // Bytes, geometric series
+    std::vector<double> upload;
+    std::vector<double> download;
+    std::vector<double> bidirectional;
+    
+    bool empty() const { return sizes.empty(); }
+};
+
+// One queue opened on the bench device
+struct BenchQueueRef {
+    VkQueue      queue = VK_NULL_HANDLE;
+    uint32_t     family = 0;
+    uint32_t     index = 0;        // Within the family
+    VkQueueFlags flags = 0;        // Family capabilities
+    bool         timestamps = false;
+};
+
+// Multi-queue scaling: one point per queue count
+struct QueueScalingPoint {
+    uint32_t            queueCount = 0;
+    double              aggregate = 0.0;  // GB/s, all queues together (wall clock)
+    std::vector<double> perQueue;         // GB/s per queue (0 = no timestamps)
+};
+
+struct QueueScalingResult {
+    std::vector<std::string>       queueLabels;  // In scaling order
+    std::vector<QueueScalingPoint> upload;
+    std::vector<QueueScalingPoint> download;
+    
+    bool empty() const { return upload.empty() && download.empty(); }
+};
+
+// Page backing of application memory imported with VK_EXT_external_memory_host
+enum class HostPageMode {
+    Normal,           // 4 KB pages
+    TransparentHuge,  // madvise(MADV_HUGEPAGE)
+    HugeTLB           // MAP_HUGETLB (needs reserved vm.nr_hugepages)
+};
+
+inline const char* HostPageModeName(HostPageMode mode) {
+    switch (mode) {
+        case HostPageMode::Normal:          return "4K";
+        case HostPageMode::TransparentHuge: return "THP";
+        case HostPageMode::HugeTLB:         return "HugeTLB";
+    }
+    return "?";
+}
+
+// Traffic the soak test keeps the link busy with
+enum class SoakTraffic { Upload, Download, Bidirectional };
+
+inline const char* SoakTrafficName(SoakTraffic traffic) {
+    switch (traffic) {
+        case SoakTraffic::Upload:        return "CPU->GPU";
+        case SoakTraffic::Download:      return "GPU->CPU";
+        case SoakTraffic::Bidirectional: return "Bidirectional";
+    }
+    return "?";
+}
+
+// Compute-shader copy bandwidth at one workgroup count
+struct ComputeCopyPoint {
+    uint32_t groups = 0;
+    double   upload = 0;      // GB/s host -> VRAM
+    double   download = 0;    // GB/s VRAM -> host
+    double   deviceCopy = 0;  // GB/s VRAM -> VRAM
+};
+
+// Compute copies over a workgroup sweep, with the DMA numbers they compete with
+struct ComputeCopyResult {
+    std::vector<ComputeCopyPoint> points;
+    double dmaUpload = 0, dmaDownload = 0, dmaDeviceCopy = 0;  // GB/s
+    
+    bool empty() const { return points.empty(); }
+};
+
+// One way of issuing the scatter/gather regions
+struct ScatterCopyTiming {
+    double bandwidth = 0;    // GB/s of region payload
+    double perRegionUs = 0;  // Batch time / region count
+};
+
+// Many small regions between packed staging memory and scattered VRAM offsets
+struct ScatterCopyResult {
+    int    regionCount = 0;
+    size_t regionSize = 0;
+    size_t stride = 0;
+    bool   random = false;
+    ScatterCopyTiming uploadBatched, uploadSeparate;      // One command with N regions / N commands
+    ScatterCopyTiming downloadBatched, downloadSeparate;
+    
+    bool empty() const { return regionCount == 0; }
+};
+
+// Buffer <-> image copy bandwidth for one format / tiling / layout
+struct ImageCopyPoint {
+    std::string format;
+    bool        linear = false;   // VK_IMAGE_TILING_LINEAR instead of OPTIMAL
+    std::string layout;           // "2D", "mips" or "array"
+    size_t      bytes = 0;        // Texel data per copy
+    double      upload = 0;       // GB/s buffer -> image
+    double      download = 0;     // GB/s image -> buffer
+};
+
+// Image copies next to the buffer copy averages of the regular runs
+struct ImageCopyResult {
+    std::vector<ImageCopyPoint> points;
+    double bufferUpload = 0, bufferDownload = 0;  // GB/s
+    
+    bool empty() const { return points.empty(); }
+};
+
+// Per-copy timestamps inside one direction's batches
+struct PerCopyTiming {
+    std::vector<double> copyGBps;   // Mean bandwidth of copy k over all batches
+    double firstGBps = 0;           // Copy 1 of each batch
+    double steadyGBps = 0;          // Copies 2..N
+    double coldPenaltyUs = 0;       // Extra time copy 1 takes over a steady copy
+    double withinBatchCV = 0;       // Mean coefficient of variation of copy times within a batch (%)
+    int    batches = 0;             // Batches with valid timestamps
+};
+
+// First-copy vs. steady-state copies for uploads and downloads
+struct PerCopyResult {
+    size_t        copySize = 0;
+    PerCopyTiming upload, download;
+    
+    bool empty() const { return copySize == 0; }
+};
+
+// One soak time-series point: the mean of bucketSeconds per-second samples
+struct SoakPoint {
+    double seconds = 0;   // Start of the bucket since the soak began
+    double gbps = 0;
+    double minGbps = 0;   // Slowest second in the bucket
+};
+
+struct SoakEvent {
+    double      seconds = 0;
+    std::string description;
+};
+
+// Soak test state. Everything is bounded: the series halves its resolution
+// when full and the aggregates are running sums, so memory does not grow
+// with the duration.
+struct SoakResult {
+    SoakTraffic            traffic = SoakTraffic::Upload;
+    double                 durationSeconds = 0;  // Requested
+    double                 elapsedSeconds = 0;
+    int                    bucketSeconds = 1;    // Seconds per series point
+    std::vector<SoakPoint> series;
+    std::vector<SoakEvent> events;
+    double                 mean = 0, min = 0, max = 0;  // GB/s over every second
+    double                 baseline = 0;                // GB/s over the baseline window (0 = not yet known)
+    double                 trendPctPerHour = 0;         // Least-squares slope relative to baseline
+    
+    bool empty() const { return series.empty(); }
+};
+
+// Local vs. remote NUMA node staging bandwidth
+struct NumaComparisonResult {
+    int    localNode = -1;
+    int    remoteNode = -1;
+    double localUpload = 0, localDownload = 0;    // GB/s
+    double remoteUpload = 0, remoteDownload = 0;  // GB/s
+    
+    bool empty() const { return remoteNode < 0; }
+};
+
+// GPU-to-GPU copy bandwidth for every ordered pair of multi-GPU sessions
+struct PeerMatrixResult {
+    std::vector<int>                 gpus;    // gpuList indices, matrix order
+    std::vector<std::vector<double>> direct;  // [src][dst] GB/s through an imported dma-buf (0 = unavailable)
+    std::vector<std::vector<double>> staged;  // [src][dst] GB/s bounced through host memory
+    
+    bool empty() const { return gpus.empty(); }
 };
 
 struct BenchmarkConfig {
@@ -357,6 +918,33 @@ struct BenchmarkConfig {
     bool   runBidirectional = true;
     bool   runLatency = true;
     bool   runMemoryLatency = true;  // GPU memory latency via compute shader pointer-chase
+    bool   runSizeSweep = false;     // Bandwidth vs. transfer size, SWEEP_MIN_SIZE..SWEEP_MAX_SIZE
+    bool   runQueueScaling = false;  // Split one transfer over 1..N queues at once
+    bool   queueScalingAllFamilies = false;  // Also use compute/graphics family queues
+    bool   multiGPU = false;         // Concurrent upload/download/bidirectional on several GPUs
+    uint64_t multiGPUMask = 0;       // gpuList indices for multiGPU (bit i = GPU i, 0 = every valid GPU)
+    bool   runPeerTest = false;      // Multi-GPU: GPU-to-GPU copy matrix (dma-buf peer + host-staged)
+    bool   runHostImport = false;    // Repeat transfers from app-allocated pages (VK_EXT_external_memory_host)
+    HostPageMode hostPageMode = HostPageMode::TransparentHuge;
+    bool   runDirectAccess = false;  // CPU writes/reads of mapped VRAM (BAR) vs. DMA
+    bool   runComputeCopy = false;   // Compute-shader copies (SM copy) vs. DMA copy engines
+    int    computeCopyGroups = 0;    // Workgroups per dispatch for runComputeCopy (0 = sweep)
+    bool   runScatterCopy = false;   // Many-region copies: one vkCmdCopyBuffer vs. one command per region
+    int    scatterRegions = Constants::DEFAULT_SCATTER_REGIONS;
+    int    scatterRegionSize = Constants::DEFAULT_SCATTER_REGION_SIZE;  // Bytes per region
+    int    scatterStride = 0;        // Bytes between VRAM regions (0 = packed)
+    bool   scatterRandom = false;    // Shuffle the VRAM region order
+    bool   runImageCopy = false;     // Buffer <-> image copies over formats, tilings and layouts
+    bool   runPerCopyTiming = false; // Timestamp after every copy in a batch: first-copy vs. steady state
+    bool   runSoak = false;          // Sustained traffic after everything else, watching for throttling
+    int    soakMinutes = Constants::DEFAULT_SOAK_MINUTES;
+    SoakTraffic soakTraffic = SoakTraffic::Bidirectional;
+    bool   adaptiveSampling = false; // Bandwidth tests: sample until the 95% CI converges (ignores batches/copies)
+    float  adaptiveCIPercent = static_cast<float>(Constants::DEFAULT_ADAPTIVE_CI_PERCENT);
+    int    adaptiveBudgetSec = Constants::DEFAULT_ADAPTIVE_BUDGET_SEC;
+    bool   useCalibratedTimestamps = true;  // Time uploads on the host clock when VK_EXT_calibrated_timestamps exists
+    bool   numaPlacement = true;     // Pin bench/scan threads and host memory to the GPU's NUMA node
+    bool   runNumaRemote = false;    // Repeat upload/download from a remote node (cross-socket penalty)
     bool   quickMode = false;
     bool   averageRuns = true;
     bool   debugLogging = false;  // Verbose diagnostic logging for memory latency test etc.
@@ -445,26 +1033,48 @@ static const int NUM_MEMORY_LATENCY_ENTRIES = sizeof(MEMORY_LATENCY_TABLE) / siz
 enum class VkBufferType {
     Upload,     // HOST_VISIBLE | HOST_COHERENT (replaces D3D12_HEAP_TYPE_UPLOAD)
     DeviceLocal,// DEVICE_LOCAL (replaces D3D12_HEAP_TYPE_DEFAULT)
-    Readback    // HOST_VISIBLE | HOST_CACHED (replaces D3D12_HEAP_TYPE_READBACK)
+    Readback,   // HOST_VISIBLE | HOST_CACHED (replaces D3D12_HEAP_TYPE_READBACK)
+    DeviceLocalMapped  // DEVICE_LOCAL | HOST_VISIBLE: VRAM the CPU writes through the BAR
 };
 
 struct VkBufferAllocation {
     VkBuffer       buffer = VK_NULL_HANDLE;
     VkDeviceMemory memory = VK_NULL_HANDLE;
     VkDeviceSize   size = 0;
-    void*          mappedPtr = nullptr;  // For persistently mapped buffers
+    void*          mappedPtr = nullptr;  // Host-visible buffers stay mapped until Destroy()
+    bool           hostCoherent = true;  // False: use FlushMappedBuffer()/InvalidateMappedBuffer()
+    void*          hostMapping = nullptr;  // Imported application pages (mappedPtr points inside), munmap'd by Destroy()
+    size_t         hostMappingSize = 0;
+    HostPageMode   hostPageMode = HostPageMode::Normal;  // Pages actually backing hostMapping
     
     bool IsValid() const { return buffer != VK_NULL_HANDLE && memory != VK_NULL_HANDLE; }
     operator bool() const { return IsValid(); }
     
     void Destroy(VkDevice device) {
+        if (mappedPtr != nullptr && memory != VK_NULL_HANDLE && hostMapping == nullptr) vkUnmapMemory(device, memory);
         if (buffer != VK_NULL_HANDLE) { vkDestroyBuffer(device, buffer, nullptr); buffer = VK_NULL_HANDLE; }
         if (memory != VK_NULL_HANDLE) { vkFreeMemory(device, memory, nullptr); memory = VK_NULL_HANDLE; }
+        if (hostMapping != nullptr) { munmap(hostMapping, hostMappingSize); hostMapping = nullptr; hostMappingSize = 0; }
+        hostPageMode = HostPageMode::Normal;
         mappedPtr = nullptr;
+        hostCoherent = true;
         size = 0;
     }
 };
 
+struct VkImageAllocation {
+    VkImage        image = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    
+    bool IsValid() const { return image != VK_NULL_HANDLE && memory != VK_NULL_HANDLE; }
+    operator bool() const { return IsValid(); }
+    
+    void Destroy(VkDevice device) {
+        if (image != VK_NULL_HANDLE) { vkDestroyImage(device, image, nullptr); image = VK_NULL_HANDLE; }
+        if (memory != VK_NULL_HANDLE) { vkFreeMemory(device, memory, nullptr); memory = VK_NULL_HANDLE; }
+    }
+};
+
 // ============================================================================
 // APPLICATION STATE
 // ============================================================================
@@ -473,12 +1083,104 @@ enum class AppState { Idle, Running, Completed };
 // Fence wait result for robust error handling
 enum class FenceWaitResult { Success, Timeout, Error, Cancelled };
 
+// Device timestamp <-> host CLOCK_MONOTONIC_RAW correlation. The first and
+// latest vkGetCalibratedTimestampsEXT pairs give the device clock's rate in
+// host nanoseconds, so drift over a long run is measured rather than assumed.
+struct ClockCalibration {
+    bool     valid = false;
+    uint64_t firstHostNs = 0;
+    uint64_t lastTicks = 0, lastHostNs = 0;  // Latest pair: conversion offset
+    int64_t  ticksSinceFirst = 0;            // Accumulated across timestamp wrap
+    double   nsPerTick = 0;                  // Fitted rate (timestampPeriod until the span is long enough)
+    uint64_t maxDeviationNs = 0;             // Worst sampling uncertainty reported by the driver
+    double   maxResidualNs = 0;              // Worst error of the previous fit at a new pair
+    int      samples = 0;
+};
+
+// Vulkan benchmark device for one GPU (separate device from rendering)
+struct BenchSession {
+    VkPhysicalDevice           physicalDevice = VK_NULL_HANDLE;
+    VkDevice                   device = VK_NULL_HANDLE;
+    VkQueue                    queue = VK_NULL_HANDLE;
+    uint32_t                   queueFamily = UINT32_MAX;
+    VkCommandPool              commandPool = VK_NULL_HANDLE;
+    VkCommandBuffer            commandBuffer = VK_NULL_HANDLE;
+    VkFence                    fence = VK_NULL_HANDLE;
+
+    // Submission engine: every submit on queue signals the next timeline
+    // value. Without VK_KHR_timeline_semaphore it falls back to fence and a
+    // ring depth of 1.
+    VkSemaphore                timeline = VK_NULL_HANDLE;
+    PFN_vkWaitSemaphores       waitSemaphores = nullptr;
+    uint64_t                   timelineValue = 0;    // Last value submitted
+    uint64_t                   completedValue = 0;   // Last value known complete
+    uint64_t                   ringValues[Constants::BENCH_SUBMIT_RING_SIZE] = {};
+    uint32_t                   ringDepth = 1;
+    uint32_t                   ringNext = 0;
+    float                      timestampPeriod = 0.0f;  // nanoseconds per tick
+    uint64_t                   timestampMask = ~0ull;   // timestampValidBits of the bench family
+    VkDeviceSize               nonCoherentAtomSize = 1; // Flush/invalidate granularity
+
+    // Calibrated timestamps (VK_EXT_calibrated_timestamps, CLOCK_MONOTONIC_RAW domain)
+    PFN_vkGetCalibratedTimestampsEXT getCalibratedTimestamps = nullptr;
+    ClockCalibration           calibration;
+
+    // Second queue for bidirectional transfers (allows true simultaneous upload/download)
+    VkQueue                    queue2 = VK_NULL_HANDLE;
+    VkCommandPool              commandPool2 = VK_NULL_HANDLE;
+    VkCommandBuffer            commandBuffer2 = VK_NULL_HANDLE;
+    VkFence                    fence2 = VK_NULL_HANDLE;
+    bool                       hasDualQueues = false;
+
+    // Every queue opened on the device, bench family first (0 = queue,
+    // 1 = queue2), then other families when queue scaling asks for them
+    std::vector<BenchQueueRef> queues;
+
+    // dma-buf export/import (VK_KHR_external_memory_fd + VK_EXT_external_memory_dma_buf),
+    // loaded only when the peer copy test is enabled
+    PFN_vkGetMemoryFdKHR           getMemoryFd = nullptr;
+    PFN_vkGetMemoryFdPropertiesKHR getMemoryFdProperties = nullptr;
+
+    // Host pointer import (VK_EXT_external_memory_host), for the imported host memory tests
+    PFN_vkGetMemoryHostPointerPropertiesEXT getMemoryHostPointerProperties = nullptr;
+    VkDeviceSize                   minImportedHostPointerAlignment = 0;
+
+    int                        fenceTimeoutCount = 0;  // Consecutive timeouts
+    std::string                logPrefix;              // Prepended to Log() lines from this session's thread
+    bool                       ownsStatus = true;      // Updates g_app.currentTest (false for multi-GPU workers)
+};
+
+// Lockstep barrier for multi-GPU sessions: every participant blocks in
+// ArriveAndWait() until all of them have arrived, then the barrier resets
+struct PhaseBarrier {
+    std::mutex              mutex;
+    std::condition_variable cv;
+    size_t                  participants = 0;
+    size_t                  arrived = 0;
+    uint64_t                generation = 0;
+};
+
+void ArriveAndWait(PhaseBarrier& barrier) {
+    std::unique_lock<std::mutex> lock(barrier.mutex);
+    uint64_t generation = barrier.generation;
+    if (++barrier.arrived == barrier.participants) {
+        barrier.arrived = 0;
+        barrier.generation++;
+        barrier.cv.notify_all();
+        return;
+    }
+    barrier.cv.wait(lock, [&] { return barrier.generation != generation; });
+}
+
 struct AppContext {
     // Window (GLFW)
     GLFWwindow* window = nullptr;
     int  windowWidth = Constants::WINDOW_WIDTH;
     int  windowHeight = Constants::WINDOW_HEIGHT;
 
+    // Headless (--headless): no window, surface or swapchain; log goes to stdout
+    bool headless = false;
+
     // Vulkan Rendering State
     VkInstance                 instance = VK_NULL_HANDLE;
     VkPhysicalDevice           renderPhysicalDevice = VK_NULL_HANDLE;
@@ -502,23 +1204,9 @@ struct AppContext {
     uint32_t                   frameIndex = 0;
     uint32_t                   imageIndex = 0;
 
-    // Vulkan Benchmark Device (separate device for benchmarking)
-    VkPhysicalDevice           benchPhysicalDevice = VK_NULL_HANDLE;
-    VkDevice                   benchDevice = VK_NULL_HANDLE;
-    VkQueue                    benchQueue = VK_NULL_HANDLE;
-    uint32_t                   benchQueueFamily = UINT32_MAX;
-    VkCommandPool              benchCommandPool = VK_NULL_HANDLE;
-    VkCommandBuffer            benchCommandBuffer = VK_NULL_HANDLE;
-    VkFence                    benchFence = VK_NULL_HANDLE;
-    uint64_t                   benchFenceValue = 1;
-    float                      benchTimestampPeriod = 0.0f;  // nanoseconds per tick
-
-    // Second queue for bidirectional transfers (allows true simultaneous upload/download)
-    VkQueue                    benchQueue2 = VK_NULL_HANDLE;
-    VkCommandPool              benchCommandPool2 = VK_NULL_HANDLE;
-    VkCommandBuffer            benchCommandBuffer2 = VK_NULL_HANDLE;
-    VkFence                    benchFence2 = VK_NULL_HANDLE;
-    bool                       hasDualQueues = false;
+    // Benchmark device state: the benchmark thread and the VRAM scan use this
+    // session; multi-GPU mode gives every worker thread its own (see Bench())
+    BenchSession               bench;
 
     // GPU list
     std::vector<GPUInfo>              gpuList;
@@ -537,10 +1225,18 @@ struct AppContext {
     std::atomic<int>   completedTests{ 0 };
     std::atomic<bool>  cancelRequested{ false };
     std::atomic<bool>  benchmarkAborted{ false };
-    std::atomic<int>   fenceTimeoutCount{ 0 };
     std::string        currentTest;
     std::mutex         resultsMutex;
     std::vector<BenchmarkResult> results;
+    SizeSweepResult    sizeSweep;  // Last sweep (guarded by resultsMutex)
+    QueueScalingResult queueScaling;  // Last queue scaling test (guarded by resultsMutex)
+    PeerMatrixResult   peerMatrix;    // Last peer copy matrix (guarded by resultsMutex)
+    NumaComparisonResult numaComparison;  // Last remote-node comparison (guarded by resultsMutex)
+    ComputeCopyResult  computeCopy;   // Last compute vs. DMA copy test (guarded by resultsMutex)
+    ScatterCopyResult  scatterCopy;   // Last many-region copy test (guarded by resultsMutex)
+    ImageCopyResult    imageCopy;     // Last buffer <-> image copy test (guarded by resultsMutex)
+    PerCopyResult      perCopy;       // Last per-copy timing test (guarded by resultsMutex)
+    SoakResult         soak;          // Current or last soak test, updated live (guarded by resultsMutex)
     std::thread        benchmarkThread;
     std::atomic<bool>  benchmarkThreadRunning{ false };
     
@@ -598,14 +1294,35 @@ struct AppContext {
     std::string vramTestCurrentPattern;
     bool showVRAMTestWindow = false;
     bool vramTestFullScan = false;
+    bool vramTestGpuVerify = true;   // Write/verify patterns with compute kernels (falls back to host)
+    bool vramTestRotateOffsets = false;  // Shift chunk boundaries within the arena on each scan
+    int  vramTestScanCount = 0;
 };
 
 static AppContext g_app;
 
+// Session used by bench code on this thread: g_app.bench unless a multi-GPU
+// worker has installed its own
+thread_local BenchSession* t_benchSession = nullptr;
+
+BenchSession& Bench() {
+    return t_benchSession ? *t_benchSession : g_app.bench;
+}
+
+// Test name shown in the progress panel
+void SetCurrentTest(const std::string& name) {
+    if (Bench().ownsStatus) g_app.currentTest = name;
+}
+
 // Helper to add log messages
 void Log(const std::string& msg) {
+    const std::string& prefix = Bench().logPrefix;
     std::lock_guard<std::mutex> lock(g_app.logMutex);
-    g_app.logLines.push_back(msg);
+    if (g_app.headless) {
+        fprintf(stdout, "%s%s\n", prefix.c_str(), msg.c_str());
+        fflush(stdout);
+    }
+    g_app.logLines.push_back(prefix + msg);
     // Keep last 500 lines
     if (g_app.logLines.size() > 500u) {
         g_app.logLines.erase(g_app.logLines.begin());
@@ -622,6 +1339,13 @@ void ClearLog() {
 // ============================================================================
 // Linux is native UTF-8 - no Unicode conversion helpers needed.
 
+// Root of every sysfs lookup; --sysfs-root points it at a fake tree for testing
+static std::string g_sysfsRoot = "/sys";
+
+static std::string SysfsPath(const std::string& relative) {
+    return g_sysfsRoot + relative;
+}
+
 // Read a sysfs file and return its trimmed content
 static std::string ReadSysfsFile(const std::string& path) {
     std::ifstream f(path);
@@ -1073,6 +1797,14 @@ std::string FormatMemory(size_t bytes) {
     return ss.str();
 }
 
+// Elapsed time as "h:mm:ss"
+std::string FormatDuration(double seconds) {
+    long total = static_cast<long>(seconds);
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%ld:%02ld:%02ld", total / 3600, (total / 60) % 60, total % 60);
+    return buf;
+}
+
 std::string FormatVendorDeviceId(uint32_t vendorId, uint32_t deviceId) {
     std::ostringstream ss;
     ss << std::hex << std::uppercase << std::setfill('0');
@@ -1080,11 +1812,35 @@ std::string FormatVendorDeviceId(uint32_t vendorId, uint32_t deviceId) {
     return ss.str();
 }
 
+// Bandwidth tests that honour adaptiveSampling in a whole benchmark
+int AdaptiveBandwidthTestCount() {
+    const BenchmarkConfig& cfg = g_app.config;
+    int perRun = 2;                          // Download + upload
+    if (cfg.runHostImport) perRun += 2;      // Same from imported pages
+    int once = 0;
+    if (cfg.runNumaRemote) once += 4;        // Local- and remote-node download + upload
+    if (cfg.runComputeCopy) once += 1;       // VRAM->VRAM DMA reference
+    return perRun * cfg.numRuns + once;
+}
+
+// Global benchmark budget; a soak run and adaptive sampling add their own time on top
+uint64_t GlobalBenchmarkTimeoutMs() {
+    uint64_t timeoutMs = Constants::GLOBAL_BENCHMARK_TIMEOUT_MS;
+    if (g_app.config.runSoak) timeoutMs += static_cast<uint64_t>(g_app.config.soakMinutes) * 60 * 1000;
+    if (g_app.config.adaptiveSampling) {
+        // Each test may use its whole budget, plus up to a quarter more for the
+        // round that crosses it (rounds are at most a quarter of the samples so far)
+        const uint64_t budgetMs = static_cast<uint64_t>(g_app.config.adaptiveBudgetSec) * 1000 * 5 / 4;
+        timeoutMs += budgetMs * static_cast<uint64_t>(AdaptiveBandwidthTestCount());
+    }
+    return timeoutMs;
+}
+
 // Check if global benchmark timeout has been exceeded
 bool IsGlobalTimeoutExceeded() {
     auto elapsed = std::chrono::steady_clock::now() - g_app.benchmarkStartTime;
-    return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() > 
-           Constants::GLOBAL_BENCHMARK_TIMEOUT_MS;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()) >
+           GlobalBenchmarkTimeoutMs();
 }
 
 // Find closest interface standard and calculate percentage
@@ -1377,10 +2133,10 @@ bool DetectPCIeLinkBySysfsPath(const std::string& sysfsPath, GPUInfo& outInfo) {
 bool DetectPCIeLink(uint32_t vendorId, uint32_t deviceId, GPUInfo& outInfo) {
     outInfo.pcieInfoValid = false;
 
-    const std::string sysfsBase = "/sys/bus/pci/devices";
+    const std::string sysfsBase = SysfsPath("/bus/pci/devices");
     DIR* dir = opendir(sysfsBase.c_str());
     if (!dir) {
-        Log("[DEBUG] Failed to open /sys/bus/pci/devices");
+        Log("[DEBUG] Failed to open " + sysfsBase);
         return false;
     }
 
@@ -1680,7 +2436,7 @@ static bool SysfsDriverContains(const std::string& devPath, const std::string& k
 
 // Helper: Check if active Thunderbolt devices exist in the TB subsystem
 static bool HasActiveThunderboltDevices() {
-    const std::string tbPath = "/sys/bus/thunderbolt/devices";
+    const std::string tbPath = SysfsPath("/bus/thunderbolt/devices");
     DIR* dir = opendir(tbPath.c_str());
     if (!dir) return false;
 
@@ -1710,7 +2466,7 @@ static bool HasActiveThunderboltDevices() {
 // Uses pcieLocationPath (BDF address like "0000:01:00.0") if available,
 // otherwise scans /sys/bus/pci/devices/ for a matching vendor:device
 static std::string FindGPUSysfsPath(uint32_t gpuVendorId, uint32_t gpuDeviceId, const GPUInfo& info) {
-    const std::string sysfsBase = "/sys/bus/pci/devices";
+    const std::string sysfsBase = SysfsPath("/bus/pci/devices");
 
     // If we have a BDF address from PCIe link detection, use it directly
     if (!info.pcieLocationPath.empty()) {
@@ -1936,7 +2692,7 @@ void DetectExternalConnection(uint32_t gpuVendorId, uint32_t gpuDeviceId, GPUInf
     // check if there are USB4-capable Type-C ports that might indicate
     // a USB4 connection
     {
-        const std::string typecPath = "/sys/class/typec";
+        const std::string typecPath = SysfsPath("/class/typec");
         DIR* dir = opendir(typecPath.c_str());
         if (dir) {
             struct dirent* entry;
@@ -2001,6 +2757,150 @@ void DetectThunderboltConnection(uint32_t gpuVendorId, uint32_t gpuDeviceId, GPU
     DetectExternalConnection(gpuVendorId, gpuDeviceId, outInfo);
 }
 
+// ============================================================================
+// NUMA PLACEMENT (Linux sysfs)
+// ============================================================================
+// On multi-socket hosts a GPU hangs off one node's root complex. Staging pages
+// on the other node cost an inter-socket hop on every DMA, and a bench thread
+// scheduled there adds the same hop to every memcpy and submit. The bench and
+// VRAM-scan threads are therefore pinned to the GPU's local_cpulist, and the
+// thread memory policy is bound to its numa_node before any staging memory is
+// allocated: driver-allocated host pages and imported host pages are both
+// faulted in by this thread, so they follow its policy. No libnuma - the two
+// syscalls involved are stable kernel ABI.
+
+namespace Numa {
+    constexpr int MPOL_DEFAULT_MODE = 0;  // <linux/mempolicy.h> MPOL_DEFAULT
+    constexpr int MPOL_BIND_MODE = 2;     // <linux/mempolicy.h> MPOL_BIND
+    constexpr int MPOL_F_NODE_FLAG = 1;   // <linux/mempolicy.h> MPOL_F_NODE
+    constexpr int MPOL_F_ADDR_FLAG = 2;   // <linux/mempolicy.h> MPOL_F_ADDR
+    constexpr unsigned MPOL_MF_STRICT_FLAG = 1;  // <linux/mempolicy.h> MPOL_MF_STRICT
+    constexpr int MAX_NODES = 64;
+    constexpr int PLACEMENT_PROBES = 64;  // Pages sampled by VerifyNumaPlacement()
+}
+
+// Parse a sysfs cpulist ("0-3,8,10-11") into CPU indices
+std::vector<int> ParseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty()) continue;
+        int first = 0, last = 0;
+        if (sscanf(range.c_str(), "%d-%d", &first, &last) == 2) {
+            for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+        } else if (sscanf(range.c_str(), "%d", &first) == 1) {
+            cpus.push_back(first);
+        }
+    }
+    return cpus;
+}
+
+std::string NumaNodeCpuList(int node) {
+    return ReadSysfsFile(SysfsPath("/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+}
+
+// Read numa_node/local_cpulist of the GPU's PCI function
+void DetectNumaNode(uint32_t gpuVendorId, uint32_t gpuDeviceId, GPUInfo& outInfo) {
+    std::string gpuSysfsPath = FindGPUSysfsPath(gpuVendorId, gpuDeviceId, outInfo);
+    if (gpuSysfsPath.empty()) return;
+
+    std::string node = ReadSysfsFile(gpuSysfsPath + "/numa_node");
+    outInfo.numaNode = node.empty() ? -1 : atoi(node.c_str());
+    if (outInfo.numaNode < 0) return;  // -1: no NUMA affinity reported
+
+    outInfo.localCpuList = ReadSysfsFile(gpuSysfsPath + "/local_cpulist");
+    if (ParseCpuList(outInfo.localCpuList).empty()) outInfo.localCpuList = NumaNodeCpuList(outInfo.numaNode);
+}
+
+// First other node that has CPUs (memory-only nodes can't host the thread)
+int FindRemoteNumaNode(int localNode) {
+    for (int node = 0; node < Numa::MAX_NODES; ++node) {
+        if (node != localNode && !ParseCpuList(NumaNodeCpuList(node)).empty()) return node;
+    }
+    return -1;
+}
+
+// Pin the calling thread to cpus and bind its future page allocations to
+// node. node < 0 restores the default policy.
+bool ApplyNumaPlacement(int node, const std::vector<int>& cpus) {
+    bool ok = true;
+    if (!cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+        }
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+            Log("[WARNING] Failed to pin thread to NUMA node " + std::to_string(node) + " CPUs");
+            ok = false;
+        }
+    }
+
+    unsigned long nodeMask = 0;
+    long result;
+    if (node >= 0 && node < Numa::MAX_NODES) {
+        nodeMask = 1ul << node;
+        result = syscall(SYS_set_mempolicy, Numa::MPOL_BIND_MODE, &nodeMask, Numa::MAX_NODES + 1);
+    } else {
+        result = syscall(SYS_set_mempolicy, Numa::MPOL_DEFAULT_MODE, nullptr, 0);
+    }
+    if (result != 0) {
+        Log("[WARNING] set_mempolicy failed: " + std::string(strerror(errno)));
+        ok = false;
+    }
+    return ok;
+}
+
+// Bind a not-yet-faulted range to node, so its pages land there regardless of
+// which thread touches them first
+bool BindRangeToNumaNode(void* ptr, size_t size, int node) {
+    if (node < 0 || node >= Numa::MAX_NODES) return false;
+    unsigned long nodeMask = 1ul << node;
+    if (syscall(SYS_mbind, ptr, size, Numa::MPOL_BIND_MODE, &nodeMask, Numa::MAX_NODES + 1,
+                Numa::MPOL_MF_STRICT_FLAG) != 0) {
+        Log("[WARNING] mbind to node " + std::to_string(node) + " failed: " + std::string(strerror(errno)));
+        return false;
+    }
+    return true;
+}
+
+// Ask the kernel which node backs a sample of pages across [ptr, ptr + size).
+// True only if every probed page is resident on node.
+bool VerifyNumaPlacement(const void* ptr, size_t size, int node) {
+    if (ptr == nullptr || size == 0) return false;
+    const uintptr_t base = reinterpret_cast<uintptr_t>(ptr);
+    const size_t step = std::max<size_t>(size / Numa::PLACEMENT_PROBES, 1);
+    for (size_t offset = 0; offset < size; offset += step) {
+        int pageNode = -1;
+        if (syscall(SYS_get_mempolicy, &pageNode, nullptr, 0, reinterpret_cast<void*>(base + offset),
+                    Numa::MPOL_F_NODE_FLAG | Numa::MPOL_F_ADDR_FLAG) != 0) {
+            Log("[WARNING] get_mempolicy failed: " + std::string(strerror(errno)));
+            return false;
+        }
+        if (pageNode != node) {
+            Log("[WARNING] NUMA: page at offset " + FormatSize(offset) + " is on node " + std::to_string(pageNode) +
+                ", expected node " + std::to_string(node));
+            return false;
+        }
+    }
+    return true;
+}
+
+// Place the calling thread (and its host allocations) on the GPU's node
+void ApplyGPUNumaPlacement(int gpuIndex) {
+    if (!g_app.config.numaPlacement || gpuIndex < 0 || gpuIndex >= static_cast<int>(g_app.gpuList.size())) return;
+    const GPUInfo& gpu = g_app.gpuList[gpuIndex];
+    if (gpu.numaNode < 0) {
+        Log("[INFO] NUMA: no node affinity reported for this GPU - thread not pinned");
+        return;
+    }
+    if (ApplyNumaPlacement(gpu.numaNode, ParseCpuList(gpu.localCpuList))) {
+        Log("[INFO] NUMA: GPU on node " + std::to_string(gpu.numaNode) + ", thread pinned to CPUs " +
+            gpu.localCpuList + ", host memory bound to node " + std::to_string(gpu.numaNode));
+    }
+}
+
 // ============================================================================
 // GPU ENUMERATION (Vulkan)
 // ============================================================================
@@ -2027,10 +2927,13 @@ void EnumerateGPUs() {
         createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
         createInfo.pApplicationInfo = &appInfo;
 
-        uint32_t glfwExtCount = 0;
-        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtCount);
-        createInfo.enabledExtensionCount = glfwExtCount;
-        createInfo.ppEnabledExtensionNames = glfwExtensions;
+        // Headless runs never initialize GLFW, so no surface extensions there
+        if (!g_app.headless) {
+            uint32_t glfwExtCount = 0;
+            const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtCount);
+            createInfo.enabledExtensionCount = glfwExtCount;
+            createInfo.ppEnabledExtensionNames = glfwExtensions;
+        }
 
         if (vkCreateInstance(&createInfo, nullptr, &enumInstance) != VK_SUCCESS) {
             Log("[ERROR] Failed to create Vulkan instance for enumeration");
@@ -2068,8 +2971,9 @@ void EnumerateGPUs() {
         VkPhysicalDeviceMemoryProperties memProps;
         vkGetPhysicalDeviceMemoryProperties(physDevice, &memProps);
 
-        // Skip CPU-only / software devices
-        if (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU) continue;
+        // Skip CPU-only / software devices in the GUI. Headless mode keeps them
+        // so CI / display-less nodes can exercise the full path on lavapipe.
+        if (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU && !g_app.headless) continue;
 
         GPUInfo info;
         info.name = props.deviceName;
@@ -2100,6 +3004,7 @@ void EnumerateGPUs() {
                 if (hasHostVisible) {
                     // HOST_VISIBLE + DEVICE_LOCAL heap
                     sharedMemory += memProps.memoryHeaps[i].size;
+                    info.cpuVisibleVRAM = std::max<size_t>(info.cpuVisibleVRAM, memProps.memoryHeaps[i].size);
                     // For discrete GPUs with ReBAR, this is still dedicated VRAM
                     // (the entire VRAM is CPU-mappable via resizable BAR)
                     // For integrated GPUs, this is carved from system RAM
@@ -2140,9 +3045,18 @@ void EnumerateGPUs() {
         info.isIntegrated = likelyIntegrated;
         info.isValid = true;
 
+        // Resizable BAR: the CPU can map (nearly) all of VRAM, not just a 256 MB window
+        info.hasReBAR = !info.isIntegrated && info.cpuVisibleVRAM > Constants::REBAR_MIN_HEAP_SIZE;
+        if (!info.isIntegrated && info.cpuVisibleVRAM > 0) {
+            Log("[INFO] GPU '" + info.name + "' CPU-visible VRAM: " + FormatMemory(info.cpuVisibleVRAM) +
+                (info.hasReBAR ? " (Resizable BAR)" : " (legacy BAR window)"));
+        }
+
         // Detect PCIe link configuration (uses SetupAPI, not graphics API)
         DetectPCIeLink(props.vendorID, props.deviceID, info);
 
+        DetectNumaNode(props.vendorID, props.deviceID, info);
+
         // Detect Thunderbolt/USB4/USB connection via device tree topology
         if (!info.isIntegrated) {
             DetectThunderboltConnection(props.vendorID, props.deviceID, info);
@@ -2225,6 +3139,56 @@ uint32_t FindMemoryType(VkPhysicalDevice physDevice, uint32_t typeFilter, VkMemo
     return UINT32_MAX;  // Not found
 }
 
+VkMemoryPropertyFlags GetMemoryTypeFlags(VkPhysicalDevice physDevice, uint32_t typeIndex) {
+    VkPhysicalDeviceMemoryProperties memProperties;
+    vkGetPhysicalDeviceMemoryProperties(physDevice, &memProperties);
+    return typeIndex < memProperties.memoryTypeCount ? memProperties.memoryTypes[typeIndex].propertyFlags : 0;
+}
+
+// Maps a freshly bound host-visible allocation for its whole lifetime
+bool MapBufferAllocation(VkDevice device, VkBufferAllocation& alloc, uint32_t memTypeIndex) {
+    VkResult result = vkMapMemory(device, alloc.memory, 0, VK_WHOLE_SIZE, 0, &alloc.mappedPtr);
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] vkMapMemory failed: " + std::to_string((int)result));
+        alloc.mappedPtr = nullptr;
+        return false;
+    }
+    alloc.hostCoherent = (GetMemoryTypeFlags(Bench().physicalDevice, memTypeIndex) &
+                          VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+    return true;
+}
+
+// Range of a non-coherent mapping, widened to nonCoherentAtomSize
+static VkMappedMemoryRange MappedRange(const VkBufferAllocation& alloc, VkDeviceSize offset, VkDeviceSize size) {
+    const VkDeviceSize atom = Bench().nonCoherentAtomSize;
+    VkMappedMemoryRange range = {};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = alloc.memory;
+    range.offset = offset / atom * atom;
+    if (size == VK_WHOLE_SIZE || offset + size >= alloc.size) {
+        range.size = VK_WHOLE_SIZE;
+    } else {
+        range.size = (offset + size - range.offset + atom - 1) / atom * atom;
+    }
+    return range;
+}
+
+// Host writes -> device. No-op for HOST_COHERENT memory.
+void FlushMappedBuffer(VkDevice device, const VkBufferAllocation& alloc,
+                       VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE) {
+    if (alloc.hostCoherent || alloc.mappedPtr == nullptr) return;
+    VkMappedMemoryRange range = MappedRange(alloc, offset, size);
+    vkFlushMappedMemoryRanges(device, 1, &range);
+}
+
+// Device writes -> host. No-op for HOST_COHERENT memory.
+void InvalidateMappedBuffer(VkDevice device, const VkBufferAllocation& alloc,
+                            VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE) {
+    if (alloc.hostCoherent || alloc.mappedPtr == nullptr) return;
+    VkMappedMemoryRange range = MappedRange(alloc, offset, size);
+    vkInvalidateMappedMemoryRanges(device, 1, &range);
+}
+
 // Helper: Find a queue family that supports the given flags
 uint32_t FindQueueFamily(VkPhysicalDevice physDevice, VkQueueFlags flags, VkSurfaceKHR surface = VK_NULL_HANDLE) {
     uint32_t queueFamilyCount = 0;
@@ -2528,10 +3492,169 @@ bool InitVulkan() {
     return true;
 }
 
+// Headless variant of InitVulkan: instance only. No GLFW surface extensions,
+// no render device, no swapchain - the benchmark device is created separately
+// by InitBenchmarkDevice() exactly as in GUI mode.
+bool InitHeadlessVulkan() {
+    VkApplicationInfo appInfo = {};
+    appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    appInfo.pApplicationName = "GPU-PCIe-Test";
+    appInfo.applicationVersion = VK_MAKE_VERSION(3, 0, 0);
+    appInfo.pEngineName = "No Engine";
+    appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
+    appInfo.apiVersion = VK_API_VERSION_1_1;
+
+    VkInstanceCreateInfo instanceInfo = {};
+    instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceInfo.pApplicationInfo = &appInfo;
+
+    VK_CHECK_RETURN(vkCreateInstance(&instanceInfo, nullptr, &g_app.instance), false);
+    return true;
+}
+
 // ============================================================================
 //                      VULKAN BENCHMARK DEVICE
 // ============================================================================
 
+bool HasDeviceExtension(VkPhysicalDevice physDevice, const char* name) {
+    uint32_t count = 0;
+    vkEnumerateDeviceExtensionProperties(physDevice, nullptr, &count, nullptr);
+    std::vector<VkExtensionProperties> extensions(count);
+    vkEnumerateDeviceExtensionProperties(physDevice, nullptr, &count, extensions.data());
+    for (const auto& ext : extensions) {
+        if (strcmp(ext.extensionName, name) == 0) return true;
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Calibrated timestamps
+// ----------------------------------------------------------------------------
+// With VK_EXT_calibrated_timestamps every GPU timestamp can be placed on the
+// host's CLOCK_MONOTONIC_RAW timeline, next to the CPU submit and wake-up times.
+
+uint64_t HostMonotonicRawNs() {
+    timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// Signed device tick difference a - b, honouring timestampValidBits wrap
+int64_t DeviceTickDelta(uint64_t a, uint64_t b) {
+    const uint64_t mask = Bench().timestampMask;
+    const uint64_t delta = (a - b) & mask;
+    if (delta > mask / 2) return -static_cast<int64_t>(mask - delta) - 1;
+    return static_cast<int64_t>(delta);
+}
+
+// Device ticks from b to a when the host clock advanced hostElapsedNs over the
+// same interval. The masked difference alone is ambiguous once the gap exceeds
+// half a wrap (36-bit counters wrap in minutes), so the number of whole wraps
+// is taken from the host time at the current rate.
+int64_t ElapsedDeviceTicks(uint64_t a, uint64_t b, uint64_t hostElapsedNs, double nsPerTick) {
+    const uint64_t mask = Bench().timestampMask;
+    const uint64_t delta = (a - b) & mask;
+    if (mask == UINT64_MAX || nsPerTick <= 0) return static_cast<int64_t>(delta);
+    const double wrapTicks = static_cast<double>(mask) + 1.0;
+    const double expected = static_cast<double>(hostElapsedNs) / nsPerTick;
+    const double wraps = std::max(0.0, std::round((expected - static_cast<double>(delta)) / wrapTicks));
+    return static_cast<int64_t>(delta) + static_cast<int64_t>(wraps) * static_cast<int64_t>(mask + 1);
+}
+
+// Device timestamp -> host CLOCK_MONOTONIC_RAW nanoseconds
+double DeviceTicksToHostNs(uint64_t ticks) {
+    const ClockCalibration& cal = Bench().calibration;
+    return static_cast<double>(cal.lastHostNs) + static_cast<double>(DeviceTickDelta(ticks, cal.lastTicks)) * cal.nsPerTick;
+}
+
+double ClockDriftPpm(const ClockCalibration& cal) {
+    return (cal.nsPerTick / static_cast<double>(Bench().timestampPeriod) - 1.0) * 1e6;
+}
+
+// One (device ticks, host ns) pair; of CALIBRATION_ATTEMPTS tries the one with
+// the smallest driver-reported deviation is kept
+bool SampleCalibratedTimestamps(uint64_t& ticks, uint64_t& hostNs, uint64_t& deviationNs) {
+    if (!Bench().getCalibratedTimestamps) return false;
+    VkCalibratedTimestampInfoEXT infos[2] = {};
+    infos[0].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+    infos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+    infos[1].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+    infos[1].timeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_EXT;
+
+    bool found = false;
+    deviationNs = UINT64_MAX;
+    for (int attempt = 0; attempt < Constants::CALIBRATION_ATTEMPTS; ++attempt) {
+        uint64_t pair[2] = {};
+        uint64_t deviation = 0;
+        if (Bench().getCalibratedTimestamps(Bench().device, 2, infos, pair, &deviation) != VK_SUCCESS) continue;
+        if (deviation < deviationNs) {
+            ticks = pair[0];
+            hostNs = pair[1];
+            deviationNs = deviation;
+            found = true;
+        }
+    }
+    return found;
+}
+
+// Adds a calibration pair. The first anchors the fit; later ones first record
+// how far the previous fit had drifted, then refit the clock rate over the
+// whole span once it exceeds CALIBRATION_MIN_SPAN_NS.
+void UpdateClockCalibration() {
+    ClockCalibration& cal = Bench().calibration;
+    uint64_t ticks = 0, hostNs = 0, deviation = 0;
+    if (!SampleCalibratedTimestamps(ticks, hostNs, deviation)) return;
+
+    if (!cal.valid) {
+        cal = ClockCalibration();
+        cal.valid = true;
+        cal.firstHostNs = hostNs;
+        cal.nsPerTick = Bench().timestampPeriod;
+    } else {
+        const int64_t elapsedTicks = ElapsedDeviceTicks(ticks, cal.lastTicks, hostNs - cal.lastHostNs, cal.nsPerTick);
+        const double predictedNs = static_cast<double>(cal.lastHostNs) + static_cast<double>(elapsedTicks) * cal.nsPerTick;
+        cal.maxResidualNs = std::max(cal.maxResidualNs, std::fabs(predictedNs - static_cast<double>(hostNs)));
+        cal.ticksSinceFirst += elapsedTicks;
+        const uint64_t span = hostNs - cal.firstHostNs;
+        if (span >= Constants::CALIBRATION_MIN_SPAN_NS && cal.ticksSinceFirst > 0) {
+            cal.nsPerTick = static_cast<double>(span) / static_cast<double>(cal.ticksSinceFirst);
+        }
+    }
+    cal.lastTicks = ticks;
+    cal.lastHostNs = hostNs;
+    cal.maxDeviationNs = std::max(cal.maxDeviationNs, deviation);
+    cal.samples++;
+}
+
+// Reads one calibrated round trip (query 0 = start, 1 = upload done, 2 = end)
+// and places it between the CPU submit and wake-up times. Returns false if
+// the GPU timestamps fall outside that window by more than the calibration
+// uncertainty - such a sample can't be trusted.
+bool ReadCalibratedRoundTrip(VkQueryPool pool, uint64_t hostSubmitNs, uint64_t hostWakeNs,
+                             HostTimeline& timeline, double& uploadSeconds) {
+    uint64_t timestamps[3] = {};
+    if (vkGetQueryPoolResults(Bench().device, pool, 0, 3, sizeof(timestamps), timestamps, sizeof(uint64_t),
+                              VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT) != VK_SUCCESS) {
+        return false;
+    }
+    const double start = DeviceTicksToHostNs(timestamps[0]);
+    const double uploaded = DeviceTicksToHostNs(timestamps[1]);
+    const double end = DeviceTicksToHostNs(timestamps[2]);
+    const double slack = 2.0 * static_cast<double>(Bench().calibration.maxDeviationNs) + Constants::CALIBRATION_SLACK_NS;
+    if (start < static_cast<double>(hostSubmitNs) - slack || end > static_cast<double>(hostWakeNs) + slack ||
+        uploaded <= start || end < uploaded) {
+        timeline.rejected++;
+        return false;
+    }
+
+    timeline.submitToStartUs += (start - static_cast<double>(hostSubmitNs)) / 1000.0;
+    timeline.transferUs += (uploaded - start) / 1000.0;
+    timeline.wakeupUs += (static_cast<double>(hostWakeNs) - end) / 1000.0;
+    timeline.samples++;
+    uploadSeconds = (uploaded - start) / 1e9;
+    return true;
+}
+
 bool InitBenchmarkDevice(int gpuIndex) {
     if (gpuIndex < 0 || gpuIndex >= static_cast<int>(g_app.gpuList.size())) {
         Log("[ERROR] Invalid GPU index: " + std::to_string(gpuIndex));
@@ -2550,22 +3673,23 @@ bool InitBenchmarkDevice(int gpuIndex) {
         return false;
     }
     
-    g_app.benchPhysicalDevice = selectedGPU.physicalDevice;
+    Bench().physicalDevice = selectedGPU.physicalDevice;
     
     // Get timestamp period for this device
     VkPhysicalDeviceProperties props;
-    vkGetPhysicalDeviceProperties(g_app.benchPhysicalDevice, &props);
-    g_app.benchTimestampPeriod = props.limits.timestampPeriod;  // nanoseconds per tick
+    vkGetPhysicalDeviceProperties(Bench().physicalDevice, &props);
+    Bench().timestampPeriod = props.limits.timestampPeriod;  // nanoseconds per tick
+    Bench().nonCoherentAtomSize = std::max<VkDeviceSize>(props.limits.nonCoherentAtomSize, 1);
     
-    if (g_app.benchTimestampPeriod == 0) {
+    if (Bench().timestampPeriod == 0) {
         Log("[WARNING] GPU reports zero timestamp period - timestamps may not be supported");
     }
     
     // Find a queue family that supports transfer (and preferably compute)
     uint32_t queueFamilyCount = 0;
-    vkGetPhysicalDeviceQueueFamilyProperties(g_app.benchPhysicalDevice, &queueFamilyCount, nullptr);
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, nullptr);
     std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
-    vkGetPhysicalDeviceQueueFamilyProperties(g_app.benchPhysicalDevice, &queueFamilyCount, queueFamilies.data());
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, queueFamilies.data());
 
     // Queue family selection strategy:
     // 1. Prefer dedicated TRANSFER family (no GRAPHICS bit) with timestamps
@@ -2594,143 +3718,329 @@ bool InitBenchmarkDevice(int gpuIndex) {
     
     // Step 2: Select primary bench queue family
     if (dedicatedTransferFamily != UINT32_MAX) {
-        g_app.benchQueueFamily = dedicatedTransferFamily;
+        Bench().queueFamily = dedicatedTransferFamily;
         Log("[INFO] Using dedicated transfer queue family " + std::to_string(dedicatedTransferFamily) + 
             " (" + std::to_string(queueFamilies[dedicatedTransferFamily].queueCount) + " queues) - direct DMA engine access");
     } else if (graphicsTransferFamily != UINT32_MAX) {
-        g_app.benchQueueFamily = graphicsTransferFamily;
+        Bench().queueFamily = graphicsTransferFamily;
         Log("[INFO] Using graphics+transfer queue family " + std::to_string(graphicsTransferFamily) +
             " (no dedicated transfer family with timestamps available)");
     } else {
         // Last resort: any family with transfer
         for (uint32_t i = 0; i < queueFamilyCount; i++) {
             if (queueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) {
-                g_app.benchQueueFamily = i;
+                Bench().queueFamily = i;
                 Log("[WARNING] Using queue family " + std::to_string(i) + " without timestamp support");
                 break;
             }
         }
     }
     
-    if (g_app.benchQueueFamily == UINT32_MAX) {
+    if (Bench().queueFamily == UINT32_MAX) {
         Log("[ERROR] No suitable queue family found on benchmark device");
         return false;
     }
+    const uint32_t validBits = queueFamilies[Bench().queueFamily].timestampValidBits;
+    Bench().timestampMask = (validBits == 0 || validBits >= 64) ? ~0ull : (1ull << validBits) - 1;
     
     // Create logical device for benchmarking
-    // Request 2 queues for bidirectional overlap (separate DMA engines)
-    uint32_t maxQueues = queueFamilies[g_app.benchQueueFamily].queueCount;
-    uint32_t requestedQueues = (maxQueues >= 2) ? 2 : 1;
-    float queuePriorities[2] = { 1.0f, 1.0f };
+    // Open every queue of the family: the first two give bidirectional overlap
+    // (separate DMA engines), all of them are used by the queue scaling test
+    uint32_t maxQueues = queueFamilies[Bench().queueFamily].queueCount;
+    uint32_t requestedQueues = std::min(maxQueues, Constants::MAX_BENCH_QUEUES_PER_FAMILY);
+    std::vector<float> queuePriorities(Constants::MAX_BENCH_QUEUES_PER_FAMILY, 1.0f);
 
     // Build queue create infos
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
     VkDeviceQueueCreateInfo transferQueueInfo = {};
     transferQueueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    transferQueueInfo.queueFamilyIndex = g_app.benchQueueFamily;
+    transferQueueInfo.queueFamilyIndex = Bench().queueFamily;
     transferQueueInfo.queueCount = requestedQueues;
-    transferQueueInfo.pQueuePriorities = queuePriorities;
+    transferQueueInfo.pQueuePriorities = queuePriorities.data();
     queueCreateInfos.push_back(transferQueueInfo);
 
+    // Queue scaling across families: every graphics/compute/transfer queue
+    if (g_app.config.runQueueScaling && g_app.config.queueScalingAllFamilies) {
+        const VkQueueFlags copyCapable = VK_QUEUE_TRANSFER_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_GRAPHICS_BIT;
+        for (uint32_t i = 0; i < queueFamilyCount; i++) {
+            if (i == Bench().queueFamily || (queueFamilies[i].queueFlags & copyCapable) == 0) continue;
+            VkDeviceQueueCreateInfo extraQueueInfo = transferQueueInfo;
+            extraQueueInfo.queueFamilyIndex = i;
+            extraQueueInfo.queueCount = std::min(queueFamilies[i].queueCount, Constants::MAX_BENCH_QUEUES_PER_FAMILY);
+            queueCreateInfos.push_back(extraQueueInfo);
+        }
+    }
+
     // Enable host query reset if available (Vulkan 1.2 feature)
     VkPhysicalDeviceHostQueryResetFeatures hostQueryResetFeatures = {};
     hostQueryResetFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES;
     hostQueryResetFeatures.hostQueryReset = VK_TRUE;
 
+    // Timeline semaphores for the submission engine (KHR extension on a 1.1 instance)
+    VkPhysicalDeviceTimelineSemaphoreFeatures timelineFeatures = {};
+    timelineFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+    bool useTimeline = false;
+    if (HasDeviceExtension(Bench().physicalDevice, VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) {
+        VkPhysicalDeviceFeatures2 features2 = {};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &timelineFeatures;
+        vkGetPhysicalDeviceFeatures2(Bench().physicalDevice, &features2);
+        useTimeline = timelineFeatures.timelineSemaphore == VK_TRUE;
+        timelineFeatures.pNext = nullptr;
+    }
+    std::vector<const char*> deviceExtensions;
+    if (useTimeline) {
+        deviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+        hostQueryResetFeatures.pNext = &timelineFeatures;
+    }
+
+    // Peer copies: device memory shared between GPUs as dma-buf
+    bool useDmaBuf = g_app.config.runPeerTest &&
+                     HasDeviceExtension(Bench().physicalDevice, VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME) &&
+                     HasDeviceExtension(Bench().physicalDevice, VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME);
+    if (useDmaBuf) {
+        if (HasDeviceExtension(Bench().physicalDevice, VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME)) {
+            deviceExtensions.push_back(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
+        }
+        deviceExtensions.push_back(VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME);
+        deviceExtensions.push_back(VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME);
+    } else if (g_app.config.runPeerTest) {
+        Log("[INFO] No dma-buf export/import - peer copies will use the host-staged path only");
+    }
+
+    // Imported host memory: application pages wrapped as VkDeviceMemory. The
+    // remote NUMA comparison needs it too, to mbind its staging pages.
+    const bool wantHostImport = g_app.config.runHostImport || g_app.config.runNumaRemote;
+    bool useHostImport = wantHostImport &&
+                         HasDeviceExtension(Bench().physicalDevice, VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
+    if (useHostImport) {
+        if (!useDmaBuf && HasDeviceExtension(Bench().physicalDevice, VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME)) {
+            deviceExtensions.push_back(VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
+        }
+        deviceExtensions.push_back(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME);
+    } else if (wantHostImport) {
+        Log(std::string("[INFO] VK_EXT_external_memory_host not supported - skipping ") +
+            (g_app.config.runHostImport ? "imported host memory tests" : "") +
+            (g_app.config.runHostImport && g_app.config.runNumaRemote ? " and " : "") +
+            (g_app.config.runNumaRemote ? "remote NUMA node comparison" : ""));
+    }
+
+    // Calibrated timestamps: needs both the device and CLOCK_MONOTONIC_RAW domains
+    bool useCalibration = g_app.config.useCalibratedTimestamps && Bench().timestampPeriod > 0 &&
+                          HasDeviceExtension(Bench().physicalDevice, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+    if (useCalibration) {
+        auto getDomains = reinterpret_cast<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>(
+            vkGetInstanceProcAddr(g_app.instance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT"));
+        uint32_t domainCount = 0;
+        std::vector<VkTimeDomainEXT> domains;
+        if (getDomains && getDomains(Bench().physicalDevice, &domainCount, nullptr) == VK_SUCCESS) {
+            domains.resize(domainCount);
+            if (getDomains(Bench().physicalDevice, &domainCount, domains.data()) != VK_SUCCESS) domains.clear();
+        }
+        auto hasDomain = [&](VkTimeDomainEXT d) { return std::find(domains.begin(), domains.end(), d) != domains.end(); };
+        useCalibration = hasDomain(VK_TIME_DOMAIN_DEVICE_EXT) && hasDomain(VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_EXT);
+    }
+    if (useCalibration) {
+        deviceExtensions.push_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+    } else if (g_app.config.useCalibratedTimestamps) {
+        Log("[INFO] No calibrated device/CLOCK_MONOTONIC_RAW timestamps - uploads use the round-trip estimate");
+    }
+
     VkDeviceCreateInfo deviceInfo = {};
     deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     deviceInfo.pNext = &hostQueryResetFeatures;
     deviceInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
     deviceInfo.pQueueCreateInfos = queueCreateInfos.data();
-    // No extensions needed for benchmark device (no swapchain)
+    deviceInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
+    deviceInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
-    VkResult result = vkCreateDevice(g_app.benchPhysicalDevice, &deviceInfo, nullptr, &g_app.benchDevice);
+    VkResult result = vkCreateDevice(Bench().physicalDevice, &deviceInfo, nullptr, &Bench().device);
     if (result != VK_SUCCESS) {
         // Retry without host query reset
-        deviceInfo.pNext = nullptr;
-        VK_CHECK_RETURN(vkCreateDevice(g_app.benchPhysicalDevice, &deviceInfo, nullptr, &g_app.benchDevice), false);
+        deviceInfo.pNext = useTimeline ? static_cast<const void*>(&timelineFeatures) : nullptr;
+        VK_CHECK_RETURN(vkCreateDevice(Bench().physicalDevice, &deviceInfo, nullptr, &Bench().device), false);
+    }
+
+    vkGetDeviceQueue(Bench().device, Bench().queueFamily, 0, &Bench().queue);
+
+    if (useDmaBuf) {
+        Bench().getMemoryFd = reinterpret_cast<PFN_vkGetMemoryFdKHR>(
+            vkGetDeviceProcAddr(Bench().device, "vkGetMemoryFdKHR"));
+        Bench().getMemoryFdProperties = reinterpret_cast<PFN_vkGetMemoryFdPropertiesKHR>(
+            vkGetDeviceProcAddr(Bench().device, "vkGetMemoryFdPropertiesKHR"));
+    }
+
+    Bench().calibration = ClockCalibration();
+    if (useCalibration) {
+        Bench().getCalibratedTimestamps = reinterpret_cast<PFN_vkGetCalibratedTimestampsEXT>(
+            vkGetDeviceProcAddr(Bench().device, "vkGetCalibratedTimestampsEXT"));
+        UpdateClockCalibration();
+        if (Bench().calibration.valid) {
+            Log("[INFO] Calibrated timestamps: device clock correlated with CLOCK_MONOTONIC_RAW (+/- " +
+                std::to_string(Bench().calibration.maxDeviationNs) + " ns)");
+        }
     }
 
-    vkGetDeviceQueue(g_app.benchDevice, g_app.benchQueueFamily, 0, &g_app.benchQueue);
+    if (useHostImport) {
+        Bench().getMemoryHostPointerProperties = reinterpret_cast<PFN_vkGetMemoryHostPointerPropertiesEXT>(
+            vkGetDeviceProcAddr(Bench().device, "vkGetMemoryHostPointerPropertiesEXT"));
+
+        VkPhysicalDeviceExternalMemoryHostPropertiesEXT hostProps = {};
+        hostProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+        VkPhysicalDeviceProperties2 props2 = {};
+        props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        props2.pNext = &hostProps;
+        vkGetPhysicalDeviceProperties2(Bench().physicalDevice, &props2);
+        Bench().minImportedHostPointerAlignment = std::max<VkDeviceSize>(hostProps.minImportedHostPointerAlignment, 4096);
+    }
 
     // Get second queue for bidirectional transfers
-    g_app.hasDualQueues = false;
+    Bench().hasDualQueues = false;
     if (requestedQueues >= 2) {
-        vkGetDeviceQueue(g_app.benchDevice, g_app.benchQueueFamily, 1, &g_app.benchQueue2);
-        g_app.hasDualQueues = true;
-        if (dedicatedTransferFamily != UINT32_MAX && g_app.benchQueueFamily == dedicatedTransferFamily) {
+        vkGetDeviceQueue(Bench().device, Bench().queueFamily, 1, &Bench().queue2);
+        Bench().hasDualQueues = true;
+        if (dedicatedTransferFamily != UINT32_MAX && Bench().queueFamily == dedicatedTransferFamily) {
             Log("[INFO] Dual DMA copy engines available for bidirectional overlap");
         } else {
             Log("[INFO] Dual queues available (graphics family - overlap may be limited)");
         }
     }
 
+    Bench().queues.clear();
+    for (const auto& info : queueCreateInfos) {
+        for (uint32_t q = 0; q < info.queueCount; ++q) {
+            BenchQueueRef ref;
+            vkGetDeviceQueue(Bench().device, info.queueFamilyIndex, q, &ref.queue);
+            ref.family = info.queueFamilyIndex;
+            ref.index = q;
+            ref.flags = queueFamilies[info.queueFamilyIndex].queueFlags;
+            ref.timestamps = queueFamilies[info.queueFamilyIndex].timestampValidBits > 0;
+            Bench().queues.push_back(ref);
+        }
+    }
+    if (Bench().queues.size() > 2) {
+        Log("[INFO] " + std::to_string(Bench().queues.size()) + " queues opened on the benchmark device");
+    }
+
     // Create command pool
     VkCommandPoolCreateInfo poolInfo = {};
     poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
     poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    poolInfo.queueFamilyIndex = g_app.benchQueueFamily;
-    VK_CHECK_RETURN(vkCreateCommandPool(g_app.benchDevice, &poolInfo, nullptr, &g_app.benchCommandPool), false);
+    poolInfo.queueFamilyIndex = Bench().queueFamily;
+    VK_CHECK_RETURN(vkCreateCommandPool(Bench().device, &poolInfo, nullptr, &Bench().commandPool), false);
 
     // Allocate command buffer
     VkCommandBufferAllocateInfo allocInfo = {};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.commandPool = g_app.benchCommandPool;
+    allocInfo.commandPool = Bench().commandPool;
     allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     allocInfo.commandBufferCount = 1;
-    VK_CHECK_RETURN(vkAllocateCommandBuffers(g_app.benchDevice, &allocInfo, &g_app.benchCommandBuffer), false);
+    VK_CHECK_RETURN(vkAllocateCommandBuffers(Bench().device, &allocInfo, &Bench().commandBuffer), false);
 
     // Create fence for synchronization
     VkFenceCreateInfo fenceInfo = {};
     fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
     // Start unsignaled so first wait works correctly
-    VK_CHECK_RETURN(vkCreateFence(g_app.benchDevice, &fenceInfo, nullptr, &g_app.benchFence), false);
+    VK_CHECK_RETURN(vkCreateFence(Bench().device, &fenceInfo, nullptr, &Bench().fence), false);
 
     // Create second command pool, command buffer, and fence for bidirectional test
-    if (g_app.hasDualQueues) {
-        VK_CHECK_RETURN(vkCreateCommandPool(g_app.benchDevice, &poolInfo, nullptr, &g_app.benchCommandPool2), false);
-        allocInfo.commandPool = g_app.benchCommandPool2;
-        VK_CHECK_RETURN(vkAllocateCommandBuffers(g_app.benchDevice, &allocInfo, &g_app.benchCommandBuffer2), false);
-        VK_CHECK_RETURN(vkCreateFence(g_app.benchDevice, &fenceInfo, nullptr, &g_app.benchFence2), false);
+    if (Bench().hasDualQueues) {
+        VK_CHECK_RETURN(vkCreateCommandPool(Bench().device, &poolInfo, nullptr, &Bench().commandPool2), false);
+        allocInfo.commandPool = Bench().commandPool2;
+        VK_CHECK_RETURN(vkAllocateCommandBuffers(Bench().device, &allocInfo, &Bench().commandBuffer2), false);
+        VK_CHECK_RETURN(vkCreateFence(Bench().device, &fenceInfo, nullptr, &Bench().fence2), false);
+    }
+
+    // Submission engine: timeline semaphore + ring of command buffers
+    Bench().timelineValue = 0;
+    Bench().completedValue = 0;
+    Bench().ringNext = 0;
+    Bench().ringDepth = 1;
+    if (useTimeline) {
+        Bench().waitSemaphores = reinterpret_cast<PFN_vkWaitSemaphores>(
+            vkGetDeviceProcAddr(Bench().device, "vkWaitSemaphoresKHR"));
+
+        VkSemaphoreTypeCreateInfo typeInfo = {};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+        VkSemaphoreCreateInfo semInfo = {};
+        semInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semInfo.pNext = &typeInfo;
+        if (Bench().waitSemaphores == nullptr ||
+            vkCreateSemaphore(Bench().device, &semInfo, nullptr, &Bench().timeline) != VK_SUCCESS) {
+            Bench().timeline = VK_NULL_HANDLE;
+        }
+    }
+    if (Bench().timeline != VK_NULL_HANDLE) {
+        Bench().ringDepth = Constants::BENCH_SUBMIT_RING_SIZE;
+        Log("[INFO] Timeline submission engine: up to " + std::to_string(Bench().ringDepth) +
+            " batches in flight");
+    } else {
+        Log("[WARNING] Timeline semaphores unavailable - bandwidth batches will serialize on a fence");
     }
+    std::fill(std::begin(Bench().ringValues), std::end(Bench().ringValues), 0);
 
-    g_app.benchFenceValue = 1;
-    g_app.fenceTimeoutCount = 0;
+    Bench().fenceTimeoutCount = 0;
 
     return true;
 }
 
 void CleanupBenchmarkDevice() {
-    if (g_app.benchDevice != VK_NULL_HANDLE) {
-        vkDeviceWaitIdle(g_app.benchDevice);
+    const ClockCalibration& cal = Bench().calibration;
+    if (cal.valid && cal.samples > 1 && Bench().timestampPeriod > 0) {
+        char buf[200];
+        snprintf(buf, sizeof(buf), "[INFO] Clock calibration: device clock %+.2f ppm vs. CLOCK_MONOTONIC_RAW over %.1f s "
+                 "(%d pairs, worst residual %.1f us)", ClockDriftPpm(cal),
+                 static_cast<double>(cal.lastHostNs - cal.firstHostNs) / 1e9, cal.samples, cal.maxResidualNs / 1000.0);
+        Log(buf);
+    }
+
+    if (Bench().device != VK_NULL_HANDLE) {
+        vkDeviceWaitIdle(Bench().device);
         
-        if (g_app.benchFence2 != VK_NULL_HANDLE) {
-            vkDestroyFence(g_app.benchDevice, g_app.benchFence2, nullptr);
-            g_app.benchFence2 = VK_NULL_HANDLE;
+        if (Bench().fence2 != VK_NULL_HANDLE) {
+            vkDestroyFence(Bench().device, Bench().fence2, nullptr);
+            Bench().fence2 = VK_NULL_HANDLE;
+        }
+        if (Bench().commandPool2 != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(Bench().device, Bench().commandPool2, nullptr);
+            Bench().commandPool2 = VK_NULL_HANDLE;
         }
-        if (g_app.benchCommandPool2 != VK_NULL_HANDLE) {
-            vkDestroyCommandPool(g_app.benchDevice, g_app.benchCommandPool2, nullptr);
-            g_app.benchCommandPool2 = VK_NULL_HANDLE;
+        Bench().commandBuffer2 = VK_NULL_HANDLE;
+
+        if (Bench().timeline != VK_NULL_HANDLE) {
+            vkDestroySemaphore(Bench().device, Bench().timeline, nullptr);
+            Bench().timeline = VK_NULL_HANDLE;
         }
-        g_app.benchCommandBuffer2 = VK_NULL_HANDLE;
 
-        if (g_app.benchFence != VK_NULL_HANDLE) {
-            vkDestroyFence(g_app.benchDevice, g_app.benchFence, nullptr);
-            g_app.benchFence = VK_NULL_HANDLE;
+        if (Bench().fence != VK_NULL_HANDLE) {
+            vkDestroyFence(Bench().device, Bench().fence, nullptr);
+            Bench().fence = VK_NULL_HANDLE;
         }
-        if (g_app.benchCommandPool != VK_NULL_HANDLE) {
-            vkDestroyCommandPool(g_app.benchDevice, g_app.benchCommandPool, nullptr);
-            g_app.benchCommandPool = VK_NULL_HANDLE;
+        if (Bench().commandPool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(Bench().device, Bench().commandPool, nullptr);
+            Bench().commandPool = VK_NULL_HANDLE;
         }
-        g_app.benchCommandBuffer = VK_NULL_HANDLE;
+        Bench().commandBuffer = VK_NULL_HANDLE;
         
-        vkDestroyDevice(g_app.benchDevice, nullptr);
-        g_app.benchDevice = VK_NULL_HANDLE;
-    }
-    g_app.benchPhysicalDevice = VK_NULL_HANDLE;
-    g_app.benchQueue2 = VK_NULL_HANDLE;
-    g_app.hasDualQueues = false;
-    g_app.benchFenceValue = 1;
+        vkDestroyDevice(Bench().device, nullptr);
+        Bench().device = VK_NULL_HANDLE;
+    }
+    Bench().physicalDevice = VK_NULL_HANDLE;
+    Bench().queue2 = VK_NULL_HANDLE;
+    Bench().hasDualQueues = false;
+    Bench().queues.clear();
+    Bench().waitSemaphores = nullptr;
+    Bench().getMemoryFd = nullptr;
+    Bench().getMemoryFdProperties = nullptr;
+    Bench().getMemoryHostPointerProperties = nullptr;
+    Bench().minImportedHostPointerAlignment = 0;
+    Bench().getCalibratedTimestamps = nullptr;
+    Bench().calibration = ClockCalibration();
+    Bench().timelineValue = 0;
+    Bench().completedValue = 0;
+    Bench().ringDepth = 1;
 }
 
 // ============================================================================
@@ -2768,9 +4078,13 @@ VkBufferAllocation CreateBuffer(VkBufferType type, VkDeviceSize size) {
             bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
             memFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
             break;
+        case VkBufferType::DeviceLocalMapped:
+            bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            memFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+            break;
     }
     
-    VkResult result = vkCreateBuffer(g_app.benchDevice, &bufferInfo, nullptr, &alloc.buffer);
+    VkResult result = vkCreateBuffer(Bench().device, &bufferInfo, nullptr, &alloc.buffer);
     if (result != VK_SUCCESS) {
         Log("[ERROR] vkCreateBuffer failed: " + std::to_string((int)result) + 
             " (Size: " + FormatSize(size) + ")");
@@ -2779,19 +4093,19 @@ VkBufferAllocation CreateBuffer(VkBufferType type, VkDeviceSize size) {
     }
     
     VkMemoryRequirements memReqs;
-    vkGetBufferMemoryRequirements(g_app.benchDevice, alloc.buffer, &memReqs);
+    vkGetBufferMemoryRequirements(Bench().device, alloc.buffer, &memReqs);
     
-    uint32_t memTypeIndex = FindMemoryType(g_app.benchPhysicalDevice, memReqs.memoryTypeBits, memFlags);
+    uint32_t memTypeIndex = FindMemoryType(Bench().physicalDevice, memReqs.memoryTypeBits, memFlags);
     
     // Fallback: For readback, try HOST_VISIBLE without HOST_CACHED
     if (memTypeIndex == UINT32_MAX && type == VkBufferType::Readback) {
         memFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        memTypeIndex = FindMemoryType(g_app.benchPhysicalDevice, memReqs.memoryTypeBits, memFlags);
+        memTypeIndex = FindMemoryType(Bench().physicalDevice, memReqs.memoryTypeBits, memFlags);
     }
     
     if (memTypeIndex == UINT32_MAX) {
         Log("[ERROR] Failed to find suitable memory type for buffer");
-        vkDestroyBuffer(g_app.benchDevice, alloc.buffer, nullptr);
+        vkDestroyBuffer(Bench().device, alloc.buffer, nullptr);
         alloc.buffer = VK_NULL_HANDLE;
         return alloc;
     }
@@ -2801,83 +4115,313 @@ VkBufferAllocation CreateBuffer(VkBufferType type, VkDeviceSize size) {
     allocInfo.allocationSize = memReqs.size;
     allocInfo.memoryTypeIndex = memTypeIndex;
     
-    result = vkAllocateMemory(g_app.benchDevice, &allocInfo, nullptr, &alloc.memory);
+    result = vkAllocateMemory(Bench().device, &allocInfo, nullptr, &alloc.memory);
     if (result != VK_SUCCESS) {
         Log("[ERROR] vkAllocateMemory failed: " + std::to_string((int)result) + 
             " (Size: " + FormatSize(size) + ")");
-        vkDestroyBuffer(g_app.benchDevice, alloc.buffer, nullptr);
+        vkDestroyBuffer(Bench().device, alloc.buffer, nullptr);
         alloc.buffer = VK_NULL_HANDLE;
         return alloc;
     }
     
-    vkBindBufferMemory(g_app.benchDevice, alloc.buffer, alloc.memory, 0);
+    vkBindBufferMemory(Bench().device, alloc.buffer, alloc.memory, 0);
+    
+    // Upload/Readback stay mapped: no map/unmap in the test loops
+    if ((memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
+        !MapBufferAllocation(Bench().device, alloc, memTypeIndex)) {
+        alloc.Destroy(Bench().device);
+    }
     
     return alloc;
 }
 
-// Enhanced fence wait with retry logic and global timeout checking
-FenceWaitResult WaitForBenchFenceEx() {
-    // Check for cancellation first
+// Upload/Readback buffer over anonymous memory the application mmap'd itself,
+// imported with VK_EXT_external_memory_host - the way an app that streams
+// from its own (hugepage-backed) allocations would avoid a staging memcpy.
+// HugeTLB falls back to THP when no huge pages are reserved; hostPageMode
+// records which one the buffer actually got. numaNode >= 0 mbinds the pages
+// to that node before they are faulted in.
+VkBufferAllocation CreateImportedHostBuffer(VkBufferType type, VkDeviceSize size, HostPageMode mode, int numaNode = -1) {
+    BenchSession& bench = Bench();
+    VkBufferAllocation alloc = {};
+    if (!bench.getMemoryHostPointerProperties || (type != VkBufferType::Upload && type != VkBufferType::Readback)) return alloc;
+
+    // Both the pointer and the allocation size must be multiples of the
+    // import alignment; huge pages additionally want 2 MB alignment
+    size_t alignment = static_cast<size_t>(bench.minImportedHostPointerAlignment);
+    if (mode != HostPageMode::Normal) alignment = std::max(alignment, Constants::HUGE_PAGE_SIZE);
+    const size_t importSize = (size + alignment - 1) / alignment * alignment;
+
+    void* mapping = MAP_FAILED;
+    size_t mappingSize = importSize;
+    if (mode == HostPageMode::HugeTLB) {
+        mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+        if (mapping == MAP_FAILED) {
+            Log("[WARNING] MAP_HUGETLB failed (" + std::string(strerror(errno)) +
+                ") - no reserved huge pages? Falling back to THP");
+            mode = HostPageMode::TransparentHuge;
+        }
+    }
+    if (mapping == MAP_FAILED) {
+        // Over-allocate so an aligned window fits; mmap only guarantees 4 KB
+        mappingSize = importSize + alignment;
+        mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) {
+            Log("[ERROR] mmap of " + FormatSize(mappingSize) + " failed: " + strerror(errno));
+            return alloc;
+        }
+    }
+    alloc.hostMapping = mapping;
+    alloc.hostMappingSize = mappingSize;
+    alloc.hostPageMode = mode;
+    uintptr_t base = reinterpret_cast<uintptr_t>(mapping);
+    void* hostPtr = reinterpret_cast<void*>((base + alignment - 1) / alignment * alignment);
+    if (mode == HostPageMode::TransparentHuge) madvise(hostPtr, importSize, MADV_HUGEPAGE);
+    if (numaNode >= 0 && !BindRangeToNumaNode(hostPtr, importSize, numaNode)) {
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+    memset(hostPtr, 0, importSize);  // Fault the pages in before the driver pins them
+
+    VkMemoryHostPointerPropertiesEXT pointerProps = {};
+    pointerProps.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+    VkResult result = bench.getMemoryHostPointerProperties(bench.device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+                                                           hostPtr, &pointerProps);
+    if (result != VK_SUCCESS || pointerProps.memoryTypeBits == 0) {
+        Log("[ERROR] Host pointer not importable: " + std::to_string((int)result));
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+
+    VkExternalMemoryBufferCreateInfo externalInfo = {};
+    externalInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    externalInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.pNext = &externalInfo;
+    bufferInfo.size = size;
+    bufferInfo.usage = type == VkBufferType::Upload ? VK_BUFFER_USAGE_TRANSFER_SRC_BIT : VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (vkCreateBuffer(bench.device, &bufferInfo, nullptr, &alloc.buffer) != VK_SUCCESS) {
+        alloc.buffer = VK_NULL_HANDLE;
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+
+    VkMemoryRequirements memReqs;
+    vkGetBufferMemoryRequirements(bench.device, alloc.buffer, &memReqs);
+    const uint32_t typeBits = memReqs.memoryTypeBits & pointerProps.memoryTypeBits;
+
+    // Same preference as CreateBuffer(): coherent for upload, cached for readback
+    VkMemoryPropertyFlags preferred = type == VkBufferType::Upload ? VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+                                                                   : VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    uint32_t memTypeIndex = FindMemoryType(bench.physicalDevice, typeBits, preferred);
+    if (memTypeIndex == UINT32_MAX) memTypeIndex = FindMemoryType(bench.physicalDevice, typeBits, 0);
+    if (memTypeIndex == UINT32_MAX) {
+        Log("[ERROR] No memory type accepts both the buffer and the imported host pointer");
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+
+    VkImportMemoryHostPointerInfoEXT importInfo = {};
+    importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+    importInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    importInfo.pHostPointer = hostPtr;
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext = &importInfo;
+    allocInfo.allocationSize = importSize;
+    allocInfo.memoryTypeIndex = memTypeIndex;
+
+    result = vkAllocateMemory(bench.device, &allocInfo, nullptr, &alloc.memory);
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] Host pointer import of " + FormatSize(importSize) + " failed: " + std::to_string((int)result));
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+    result = vkBindBufferMemory(bench.device, alloc.buffer, alloc.memory, 0);
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] Binding imported host memory failed: " + std::to_string((int)result));
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+
+    alloc.size = size;
+    alloc.mappedPtr = hostPtr;
+    alloc.hostCoherent = (GetMemoryTypeFlags(bench.physicalDevice, memTypeIndex) &
+                          VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+    return alloc;
+}
+
+// Cancellation and global timeout checks shared by the fence and timeline waits
+FenceWaitResult CheckBeforeBenchWait() {
     if (g_app.cancelRequested || g_app.vramTestCancelRequested) {
         return FenceWaitResult::Cancelled;
     }
-    
-    // Check global timeout
     if (!g_app.vramTestRunning && IsGlobalTimeoutExceeded()) {
-        Log("[ERROR] Global benchmark timeout exceeded (5 minutes)");
+        Log("[ERROR] Global benchmark timeout exceeded (" + std::to_string(GlobalBenchmarkTimeoutMs() / 60000) + " minutes)");
         return FenceWaitResult::Timeout;
     }
-    
-    // Wait for fence
-    uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL; // ms -> ns
-    VkResult result = vkWaitForFences(g_app.benchDevice, 1, &g_app.benchFence, VK_TRUE, timeout);
-    
+    return FenceWaitResult::Success;
+}
+
+// Timeout/retry bookkeeping for a finished wait call
+FenceWaitResult ClassifyBenchWait(VkResult result, const char* call) {
     if (result == VK_TIMEOUT) {
-        g_app.fenceTimeoutCount++;
+        Bench().fenceTimeoutCount++;
         Log("[WARNING] Benchmark fence wait timed out after " + 
             std::to_string(Constants::FENCE_WAIT_TIMEOUT_MS / 1000) + "s (timeout #" + 
-            std::to_string(g_app.fenceTimeoutCount.load()) + ")");
+            std::to_string(Bench().fenceTimeoutCount) + ")");
         
-        if (g_app.fenceTimeoutCount >= Constants::MAX_FENCE_RETRIES) {
+        if (Bench().fenceTimeoutCount >= Constants::MAX_FENCE_RETRIES) {
             Log("[ERROR] Max fence timeouts exceeded - possible GPU hang. Aborting benchmark.");
             g_app.benchmarkAborted = true;
             return FenceWaitResult::Timeout;
         }
         return FenceWaitResult::Timeout;
     } else if (result != VK_SUCCESS) {
-        Log("[ERROR] vkWaitForFences failed: " + std::to_string((int)result));
+        Log(std::string("[ERROR] ") + call + " failed: " + std::to_string((int)result));
         return FenceWaitResult::Error;
     }
     
-    // Reset fence for next use
-    vkResetFences(g_app.benchDevice, 1, &g_app.benchFence);
-    
     // Success - reset timeout counter
-    g_app.fenceTimeoutCount = 0;
-    g_app.benchFenceValue++;
+    Bench().fenceTimeoutCount = 0;
     return FenceWaitResult::Success;
 }
 
-// Submit bench command buffer and wait
-FenceWaitResult SubmitAndWait() {
+// Enhanced fence wait with retry logic and global timeout checking.
+// Works on any fence created on the bench device (or on device, if given); resets it on success.
+FenceWaitResult WaitForFenceEx(VkFence fence, VkDevice device = VK_NULL_HANDLE) {
+    if (device == VK_NULL_HANDLE) device = Bench().device;
+    
+    FenceWaitResult check = CheckBeforeBenchWait();
+    if (check != FenceWaitResult::Success) return check;
+    
+    uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL; // ms -> ns
+    FenceWaitResult result = ClassifyBenchWait(vkWaitForFences(device, 1, &fence, VK_TRUE, timeout),
+                                               "vkWaitForFences");
+    
+    // Reset fence for next use
+    if (result == FenceWaitResult::Success) vkResetFences(device, 1, &fence);
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Bench submission engine
+// ----------------------------------------------------------------------------
+// Each bench queue submit signals the next value of Bench().timeline, and
+// callers wait for the value of the batch they need rather than idling the
+// queue. The ring lets bandwidth tests keep ringDepth batches queued.
+// Without timeline support submits signal the session fence, which must be waited
+// before the next submit (ring depth 1).
+
+// Submits cmds (in order) on the bench queue. Returns the value that marks their
+// completion, 0 on failure.
+uint64_t SubmitBenchCommandBuffers(const VkCommandBuffer* cmds, uint32_t count) {
+    const uint64_t value = Bench().timelineValue + 1;
+
     VkSubmitInfo submitInfo = {};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &g_app.benchCommandBuffer;
-    
-    VkResult result = vkQueueSubmit(g_app.benchQueue, 1, &submitInfo, g_app.benchFence);
+    submitInfo.commandBufferCount = count;
+    submitInfo.pCommandBuffers = cmds;
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo = {};
+    VkFence fence = Bench().fence;
+    if (Bench().timeline != VK_NULL_HANDLE) {
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.signalSemaphoreValueCount = 1;
+        timelineInfo.pSignalSemaphoreValues = &value;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &Bench().timeline;
+        fence = VK_NULL_HANDLE;
+    }
+
+    VkResult result = vkQueueSubmit(Bench().queue, 1, &submitInfo, fence);
     if (result != VK_SUCCESS) {
         Log("[ERROR] vkQueueSubmit failed: " + std::to_string((int)result));
-        return FenceWaitResult::Error;
+        return 0;
     }
-    
-    return WaitForBenchFenceEx();
+    Bench().timelineValue = value;
+    return value;
+}
+
+// Waits until every bench submit up to `value` has completed
+FenceWaitResult WaitForBenchValue(uint64_t value) {
+    if (value <= Bench().completedValue) return FenceWaitResult::Success;
+
+    if (Bench().timeline == VK_NULL_HANDLE) {
+        FenceWaitResult result = WaitForFenceEx(Bench().fence);
+        if (result == FenceWaitResult::Success) Bench().completedValue = Bench().timelineValue;
+        return result;
+    }
+
+    FenceWaitResult check = CheckBeforeBenchWait();
+    if (check != FenceWaitResult::Success) return check;
+
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &Bench().timeline;
+    waitInfo.pValues = &value;
+    uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL;
+    FenceWaitResult result = ClassifyBenchWait(Bench().waitSemaphores(Bench().device, &waitInfo, timeout),
+                                               "vkWaitSemaphores");
+    if (result == FenceWaitResult::Success) Bench().completedValue = value;
+    return result;
+}
+
+// Bounded wait for every bench submit, ignoring cancellation: used before
+// freeing command buffers or query pools a cancelled wait left in flight
+void DrainBenchQueue() {
+    const uint64_t value = Bench().timelineValue;
+    if (value <= Bench().completedValue) return;
+
+    uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL;
+    if (Bench().timeline != VK_NULL_HANDLE) {
+        VkSemaphoreWaitInfo waitInfo = {};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &Bench().timeline;
+        waitInfo.pValues = &value;
+        if (Bench().waitSemaphores(Bench().device, &waitInfo, timeout) == VK_SUCCESS) {
+            Bench().completedValue = value;
+        }
+    } else if (vkWaitForFences(Bench().device, 1, &Bench().fence, VK_TRUE, timeout) == VK_SUCCESS) {
+        vkResetFences(Bench().device, 1, &Bench().fence);
+        Bench().completedValue = value;
+    }
+}
+
+// Next ring slot. Blocks until the batch last submitted from the slot has
+// completed, so its command buffers and queries may be reused; returns the
+// slot index, or UINT32_MAX with waitResult set if that wait failed.
+uint32_t AcquireBenchRingSlot(FenceWaitResult& waitResult) {
+    const uint32_t slot = Bench().ringNext;
+    waitResult = WaitForBenchValue(Bench().ringValues[slot]);
+    if (waitResult != FenceWaitResult::Success) return UINT32_MAX;
+    Bench().ringNext = (slot + 1) % Bench().ringDepth;
+    return slot;
+}
+
+// Submits a slot's command buffers without waiting for them
+bool SubmitBenchRingSlot(uint32_t slot, const VkCommandBuffer* cmds, uint32_t count) {
+    Bench().ringValues[slot] = SubmitBenchCommandBuffers(cmds, count);
+    return Bench().ringValues[slot] != 0;
+}
+
+// Submit command buffers and wait
+FenceWaitResult SubmitAndWait(const VkCommandBuffer* cmds, uint32_t count) {
+    uint64_t value = SubmitBenchCommandBuffers(cmds, count);
+    if (value == 0) return FenceWaitResult::Error;
+    return WaitForBenchValue(value);
 }
 
-// Legacy wrapper
-void WaitForBenchFence() {
-    // For legacy compatibility - assumes command buffer already submitted
-    // This is used after explicit SubmitAndWait patterns
+// Submit bench command buffer and wait
+FenceWaitResult SubmitAndWait() {
+    return SubmitAndWait(&Bench().commandBuffer, 1);
 }
 
 bool ShouldAbortBenchmark() {
@@ -2886,19 +4430,311 @@ bool ShouldAbortBenchmark() {
 
 // Helper: Begin recording benchmark command buffer
 void BeginBenchCommandBuffer() {
-    vkResetCommandBuffer(g_app.benchCommandBuffer, 0);
+    vkResetCommandBuffer(Bench().commandBuffer, 0);
     VkCommandBufferBeginInfo beginInfo = {};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    vkBeginCommandBuffer(g_app.benchCommandBuffer, &beginInfo);
+    vkBeginCommandBuffer(Bench().commandBuffer, &beginInfo);
 }
 
 // Helper: End recording and submit benchmark command buffer
 FenceWaitResult EndAndSubmitBenchCommandBuffer() {
-    vkEndCommandBuffer(g_app.benchCommandBuffer);
+    vkEndCommandBuffer(Bench().commandBuffer);
     return SubmitAndWait();
 }
 
+// ----------------------------------------------------------------------------
+// Pre-recorded bench command buffers
+// ----------------------------------------------------------------------------
+// Tests record each distinct batch once, without ONE_TIME_SUBMIT, and resubmit
+// it for every batch and run, so recording cost stays out of the timed loop.
+// Timestamp queries are reset by a separate recorded command buffer submitted
+// in front of the batch that writes them.
+
+// count reusable command buffers from the session command pool (empty on failure)
+std::vector<VkCommandBuffer> AllocateBenchCommandBuffers(uint32_t count) {
+    std::vector<VkCommandBuffer> cmds(count, VK_NULL_HANDLE);
+    VkCommandBufferAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = Bench().commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = count;
+    VkResult result = vkAllocateCommandBuffers(Bench().device, &allocInfo, cmds.data());
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] vkAllocateCommandBuffers failed: " + std::to_string((int)result));
+        cmds.clear();
+    }
+    return cmds;
+}
+
+void FreeBenchCommandBuffers(std::vector<VkCommandBuffer>& cmds) {
+    if (!cmds.empty()) {
+        DrainBenchQueue();
+        vkFreeCommandBuffers(Bench().device, Bench().commandPool, static_cast<uint32_t>(cmds.size()), cmds.data());
+    }
+    cmds.clear();
+}
+
+// Begins a recording that may be submitted any number of times
+void BeginReusableCommandBuffer(VkCommandBuffer cmd) {
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(cmd, &beginInfo);
+}
+
+// Records `copies` src -> dst copies of `size` bytes
+void RecordBenchCopies(VkCommandBuffer cmd, VkBuffer src, VkBuffer dst, size_t size, int copies) {
+    VkBufferCopy copyRegion = {};
+    copyRegion.size = size;
+    for (int j = 0; j < copies; ++j) {
+        vkCmdCopyBuffer(cmd, src, dst, 1, &copyRegion);
+    }
+}
+
+// GPU-timestamped batches through the submission ring, shared by the buffer
+// and image copy tests. record() adds one batch of batchGB to a command
+// buffer; bandwidth samples are appended to bandwidths. Returns false if the
+// query pool could not be created. logSustained logs the back-to-back rate.
+bool RunTimestampedBatches(const std::string& name, const std::function<void(VkCommandBuffer)>& record,
+                           double batchGB, int batches, std::vector<double>& bandwidths, int& failedBatches,
+                           bool logSustained = true) {
+    // Batches go through the submission ring. Each slot owns a
+    // timestamp pair that is read back when the slot comes round again
+    // (or at the final drain), so up to ringDepth batches stay
+    // queued and the copy engine never idles between them.
+    const uint32_t depth = Bench().ringDepth;
+    VkQueryPoolCreateInfo queryPoolInfo = {};
+    queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolInfo.queryCount = depth * 2;
+    
+    VkQueryPool queryPool = VK_NULL_HANDLE;
+    if (vkCreateQueryPool(Bench().device, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
+        Log("[ERROR] Failed to create timestamp query pool in bandwidth test");
+        return false;
+    }
+
+    // Per slot, recorded once: [query reset, timestamped batch]
+    std::vector<VkCommandBuffer> slotCmds = AllocateBenchCommandBuffers(depth * 2);
+    for (uint32_t slot = 0; slot < depth && !slotCmds.empty(); ++slot) {
+        VkCommandBuffer resetCmd = slotCmds[slot * 2];
+        BeginReusableCommandBuffer(resetCmd);
+        vkCmdResetQueryPool(resetCmd, queryPool, slot * 2, 2);
+        vkEndCommandBuffer(resetCmd);
+
+        VkCommandBuffer batchCmd = slotCmds[slot * 2 + 1];
+        BeginReusableCommandBuffer(batchCmd);
+        // D3D12 equivalent: EndQuery(TIMESTAMP) as first command in list.
+        vkCmdWriteTimestamp(batchCmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, slot * 2);
+        record(batchCmd);
+        vkCmdWriteTimestamp(batchCmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, slot * 2 + 1);
+        vkEndCommandBuffer(batchCmd);
+    }
+
+    std::vector<bool> slotPending(depth, false);
+    uint64_t firstStart = 0, prevEnd = 0;
+    int collected = 0;
+
+    // Reads one finished batch. Its start is clamped to the previous
+    // batch's end: with batches queued back to back, TOP_OF_PIPE can
+    // fire while the previous batch's copies are still running.
+    auto collectSlot = [&](uint32_t slot) {
+        if (!slotPending[slot]) return;
+        slotPending[slot] = false;
+
+        uint64_t timestamps[2] = {};
+        VkResult qr = vkGetQueryPoolResults(Bench().device, queryPool, slot * 2, 2,
+            sizeof(timestamps), timestamps, sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        
+        uint64_t start = std::max(timestamps[0], prevEnd);
+        if (qr == VK_SUCCESS && timestamps[1] > start) {
+            if (collected == 0) firstStart = timestamps[0];
+            prevEnd = timestamps[1];
+            double seconds = static_cast<double>(timestamps[1] - start) *
+                             static_cast<double>(Bench().timestampPeriod) / 1e9;
+            bandwidths.push_back(batchGB / seconds);
+            collected++;
+        } else {
+            failedBatches++;
+        }
+        g_app.progress = static_cast<float>(collected + failedBatches) / static_cast<float>(batches);
+    };
+
+    for (int i = 0; i < batches && !slotCmds.empty() && !ShouldAbortBenchmark(); ++i) {
+        FenceWaitResult fenceResult = FenceWaitResult::Success;
+        uint32_t slot = AcquireBenchRingSlot(fenceResult);
+        if (fenceResult == FenceWaitResult::Cancelled) break;
+        if (slot == UINT32_MAX) {
+            Log("[ERROR] Critical fence error - aborting bandwidth test");
+            break;
+        }
+        collectSlot(slot);
+
+        if (!SubmitBenchRingSlot(slot, &slotCmds[slot * 2], 2)) break;
+        slotPending[slot] = true;
+    }
+
+    // Drain: wait for the last submit, then read the remaining slots in submission order
+    FenceWaitResult drainResult = WaitForBenchValue(Bench().timelineValue);
+    if (drainResult == FenceWaitResult::Success) {
+        for (uint32_t k = 0; k < depth; ++k) collectSlot((Bench().ringNext + k) % depth);
+    } else {
+        DrainBenchQueue();  // Queued batches still use the query pool
+    }
+    FreeBenchCommandBuffers(slotCmds);
+
+    if (logSustained && collected > 1 && prevEnd > firstStart) {
+        double seconds = static_cast<double>(prevEnd - firstStart) *
+                         static_cast<double>(Bench().timestampPeriod) / 1e9;
+        Log("[INFO] " + name + ": sustained " + std::to_string(batchGB * collected / seconds) +
+            " GB/s over " + std::to_string(collected) + " batches (" + std::to_string(depth) +
+            " in flight)");
+    }
+    
+    vkDestroyQueryPool(Bench().device, queryPool, nullptr);
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Sample statistics / adaptive sampling
+// ----------------------------------------------------------------------------
+
+double MedianOf(std::vector<double> values) {
+    if (values.empty()) return 0.0;
+    auto mid = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), mid, values.end());
+    return *mid;
+}
+
+// Outlier rule: a sample is dropped when its modified z-score
+// 0.6745 * |x - median| / MAD exceeds ADAPTIVE_OUTLIER_Z (Iglewicz & Hoaglin),
+// i.e. a batch hit by preemption or a background transfer. If more than a
+// quarter of the samples would go, the spread is real and nothing is dropped.
+// Returns the number removed.
+size_t RejectOutliers(std::vector<double>& samples) {
+    if (samples.size() < 4) return 0;
+    const double median = MedianOf(samples);
+    std::vector<double> deviations(samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) deviations[i] = std::fabs(samples[i] - median);
+    const double mad = MedianOf(deviations);
+    if (mad <= 0.0) return 0;
+
+    auto isOutlier = [&](double x) { return 0.6745 * std::fabs(x - median) / mad > Constants::ADAPTIVE_OUTLIER_Z; };
+    const size_t outliers = static_cast<size_t>(std::count_if(samples.begin(), samples.end(), isOutlier));
+    if (outliers == 0 || outliers > samples.size() / 4) return 0;
+    samples.erase(std::remove_if(samples.begin(), samples.end(), isOutlier), samples.end());
+    return outliers;
+}
+
+// 95% percentile-bootstrap confidence interval of the mean. Fixed seed, so
+// the same samples always give the same interval. Leaves low/high at 0 for
+// fewer than two samples.
+void BootstrapMeanCI(const std::vector<double>& samples, double& low, double& high) {
+    low = high = 0.0;
+    if (samples.size() < 2) return;
+
+    std::mt19937 rng(0x5EED);
+    std::uniform_int_distribution<size_t> pick(0, samples.size() - 1);
+    std::vector<double> means(Constants::ADAPTIVE_BOOTSTRAP_RESAMPLES);
+    for (double& mean : means) {
+        double sum = 0.0;
+        for (size_t i = 0; i < samples.size(); ++i) sum += samples[pick(rng)];
+        mean = sum / samples.size();
+    }
+    std::sort(means.begin(), means.end());
+    low = means[means.size() * 25 / 1000];
+    high = means[means.size() * 975 / 1000];
+}
+
+// Copies per batch so that one batch lasts about ADAPTIVE_BATCH_MS, from one
+// timed single copy after an untimed one
+int AdaptiveCopiesPerBatch(VkBufferAllocation& src, VkBufferAllocation& dst, size_t size) {
+    std::vector<VkCommandBuffer> cmd = AllocateBenchCommandBuffers(1);
+    if (cmd.empty()) return g_app.config.copiesPerBatch;
+    BeginReusableCommandBuffer(cmd[0]);
+    RecordBenchCopies(cmd[0], src.buffer, dst.buffer, size, 1);
+    vkEndCommandBuffer(cmd[0]);
+
+    SubmitAndWait(cmd.data(), 1);
+    auto startTime = std::chrono::high_resolution_clock::now();
+    FenceWaitResult fenceResult = SubmitAndWait(cmd.data(), 1);
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+    FreeBenchCommandBuffers(cmd);
+
+    if (fenceResult != FenceWaitResult::Success || seconds <= 0) return g_app.config.copiesPerBatch;
+    long copies = std::lround(Constants::ADAPTIVE_BATCH_MS / 1000.0 / seconds);
+    return static_cast<int>(std::clamp(copies, 1L, static_cast<long>(Constants::ADAPTIVE_MAX_COPIES)));
+}
+
+// Calls runBatches() in growing rounds until the 95% CI of the mean (outliers
+// removed) is within adaptiveCIPercent of the mean, the per-test time budget
+// is spent or ADAPTIVE_MAX_SAMPLES are in. Outliers are removed from
+// bandwidths on return.
+void RunAdaptiveSampling(BenchmarkResult& result, std::vector<double>& bandwidths,
+                         const std::function<bool(int)>& runBatches) {
+    const auto startTime = std::chrono::steady_clock::now();
+    const double budget = static_cast<double>(g_app.config.adaptiveBudgetSec);
+    const double target = g_app.config.adaptiveCIPercent / 100.0;
+    const char* stopReason = "time budget";
+    double width = 0.0;
+
+    for (;;) {
+        const int have = static_cast<int>(bandwidths.size());
+        const int round = std::min(std::max(Constants::ADAPTIVE_MIN_SAMPLES / 2, have / 4),
+                                   Constants::ADAPTIVE_MAX_SAMPLES - have);
+        if (!runBatches(round)) {
+            stopReason = "stopped";
+            break;
+        }
+
+        if (bandwidths.size() >= static_cast<size_t>(Constants::ADAPTIVE_MIN_SAMPLES)) {
+            std::vector<double> kept = bandwidths;
+            RejectOutliers(kept);
+            double low = 0, high = 0;
+            BootstrapMeanCI(kept, low, high);
+            const double mean = std::accumulate(kept.begin(), kept.end(), 0.0) / kept.size();
+            width = mean > 0 ? (high - low) / mean : 0.0;
+            if (mean > 0 && width <= target) {
+                stopReason = "converged";
+                break;
+            }
+        }
+        if (bandwidths.size() >= static_cast<size_t>(Constants::ADAPTIVE_MAX_SAMPLES)) {
+            stopReason = "sample limit";
+            break;
+        }
+
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        if (elapsed >= budget) break;
+        g_app.progress = static_cast<float>(elapsed / budget);
+    }
+
+    result.rejectedSamples = static_cast<int>(RejectOutliers(bandwidths));
+    char buf[160];
+    snprintf(buf, sizeof(buf), "%zu samples, 95%% CI width %.2f%% (%s), %d outliers rejected",
+             bandwidths.size(), width * 100.0, stopReason, result.rejectedSamples);
+    Log("[INFO] " + result.testName + ": " + buf);
+}
+
+// Fills result's statistics from the collected bandwidth samples
+void SummarizeBandwidthSamples(BenchmarkResult& result, std::vector<double>& bandwidths, int failedBatches) {
+    if (!bandwidths.empty()) {
+        std::sort(bandwidths.begin(), bandwidths.end());
+        result.minValue = bandwidths.front();
+        result.maxValue = bandwidths.back();
+        result.avgValue = std::accumulate(bandwidths.begin(), bandwidths.end(), 0.0) / bandwidths.size();
+        BootstrapMeanCI(bandwidths, result.ciLow, result.ciHigh);
+        result.samples = std::move(bandwidths);
+        
+        if (failedBatches > 0) {
+            Log("[WARNING] " + std::to_string(failedBatches) + " batches failed in " + result.testName);
+        }
+    } else {
+        Log("[WARNING] No valid samples collected for " + result.testName);
+    }
+}
+
 // Bandwidth test with configurable measurement method
 // 
 // Runs on the dedicated transfer/copy queue (D3D12 equivalent: COPY queue).
@@ -2917,8 +4753,17 @@ FenceWaitResult EndAndSubmitBenchCommandBuffer() {
 //     upload_time = round_trip_time - (data_size / measured_download_speed)
 //   D3D12 equivalent: identical logic with CopyResource on COPY queue.
 //
-BenchmarkResult RunBandwidthTest(const std::string& name, VkBufferAllocation& src, VkBufferAllocation& dst, size_t size, int copies, int batches, bool useCpuTiming = false, double measuredDownloadGB = 0.0) {
-    g_app.currentTest = name;
+// roundtripBuffer, if given, is used as the round-trip readback target instead
+// of allocating one (it must hold at least `size` bytes).
+//
+// With calibrated timestamps the round trip is timestamped at its start, after
+// the upload and at its end, and the upload time is read off the host
+// timeline directly instead of being estimated from the download speed.
+//
+// With config.adaptiveSampling (and allowAdaptive), copies is replaced by an
+// auto-sized count and batches by RunAdaptiveSampling()'s stopping rule.
+BenchmarkResult RunBandwidthTest(const std::string& name, VkBufferAllocation& src, VkBufferAllocation& dst, size_t size, int copies, int batches, bool useCpuTiming = false, double measuredDownloadGB = 0.0, VkBufferAllocation* roundtripBuffer = nullptr, bool allowAdaptive = true) {
+    SetCurrentTest(name);
     BenchmarkResult result;
     result.testName = name;
     result.unit = "GB/s";
@@ -2931,74 +4776,119 @@ BenchmarkResult RunBandwidthTest(const std::string& name, VkBufferAllocation& sr
     std::vector<double> bandwidths;
     bandwidths.reserve(batches);
     int failedBatches = 0;
+    const bool adaptive = allowAdaptive && g_app.config.adaptiveSampling;
+    if (adaptive) {
+        copies = AdaptiveCopiesPerBatch(src, dst, size);
+        Log("[INFO] " + name + ": adaptive sampling, " + std::to_string(copies) + " copies/batch");
+    }
+    
+    // Plain copy batch, recorded once: warm-up and the CPU-timed fallback
+    std::vector<VkCommandBuffer> copyCmd = AllocateBenchCommandBuffers(1);
+    if (copyCmd.empty()) return result;
+    BeginReusableCommandBuffer(copyCmd[0]);
+    RecordBenchCopies(copyCmd[0], src.buffer, dst.buffer, size, copies);
+    vkEndCommandBuffer(copyCmd[0]);
     
     // Warm-up pass
-    {
-        BeginBenchCommandBuffer();
-        for (int j = 0; j < copies; ++j) {
-            VkBufferCopy copyRegion = {};
-            copyRegion.size = size;
-            vkCmdCopyBuffer(g_app.benchCommandBuffer, src.buffer, dst.buffer, 1, &copyRegion);
-        }
-        EndAndSubmitBenchCommandBuffer();
-    }
+    SubmitAndWait(copyCmd.data(), 1);
 
+    // Round-trip timing mode for accurate CPU->GPU measurement
+    VkBufferAllocation roundtripReadback;
+    std::vector<VkCommandBuffer> roundtripCmd;
+    VkQueryPool calibratedPool = VK_NULL_HANDLE;  // Set: round trips are read on the host timeline
     if (useCpuTiming) {
-        // Round-trip timing mode for accurate CPU->GPU measurement
-        auto roundtripReadback = CreateBuffer(VkBufferType::Readback, size);
+        roundtripReadback = roundtripBuffer ? *roundtripBuffer : CreateBuffer(VkBufferType::Readback, size);
         if (!roundtripReadback) {
             Log("[WARNING] Could not create round-trip readback buffer - falling back to GPU timestamps");
             useCpuTiming = false;
         } else {
-            for (int i = 0; i < batches && !ShouldAbortBenchmark(); ++i) {
-                if (i % 8 == 0) {
-                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+            if (Bench().calibration.valid) {
+                VkQueryPoolCreateInfo queryPoolInfo = {};
+                queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+                queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+                queryPoolInfo.queryCount = 3;
+                if (vkCreateQueryPool(Bench().device, &queryPoolInfo, nullptr, &calibratedPool) != VK_SUCCESS) {
+                    calibratedPool = VK_NULL_HANDLE;
                 }
-                
-                BeginBenchCommandBuffer();
+                UpdateClockCalibration();
+            }
+
+            // Round trip, recorded once ([query reset,] round trip)
+            roundtripCmd = AllocateBenchCommandBuffers(calibratedPool ? 2 : 1);
+            if (!roundtripCmd.empty()) {
+                VkCommandBuffer cmd = roundtripCmd.back();
+                if (calibratedPool) {
+                    BeginReusableCommandBuffer(roundtripCmd[0]);
+                    vkCmdResetQueryPool(roundtripCmd[0], calibratedPool, 0, 3);
+                    vkEndCommandBuffer(roundtripCmd[0]);
+                }
+                BeginReusableCommandBuffer(cmd);
+                if (calibratedPool) vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, calibratedPool, 0);
                 
                 // Upload: CPU -> GPU
-                for (int j = 0; j < copies; ++j) {
-                    VkBufferCopy copyRegion = {};
-                    copyRegion.size = size;
-                    vkCmdCopyBuffer(g_app.benchCommandBuffer, src.buffer, dst.buffer, 1, &copyRegion);
-                }
+                RecordBenchCopies(cmd, src.buffer, dst.buffer, size, copies);
                 
                 // Memory barrier to ensure upload completes before readback
                 VkMemoryBarrier memBarrier = {};
                 memBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
                 memBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
                 memBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-                vkCmdPipelineBarrier(g_app.benchCommandBuffer,
+                vkCmdPipelineBarrier(cmd,
                     VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
                     0, 1, &memBarrier, 0, nullptr, 0, nullptr);
+                if (calibratedPool) vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, calibratedPool, 1);
                 
                 // Download: GPU -> CPU (creates data dependency)
-                for (int j = 0; j < copies; ++j) {
-                    VkBufferCopy copyRegion = {};
-                    copyRegion.size = size;
-                    vkCmdCopyBuffer(g_app.benchCommandBuffer, dst.buffer, roundtripReadback.buffer, 1, &copyRegion);
+                RecordBenchCopies(cmd, dst.buffer, roundtripReadback.buffer, size, copies);
+                if (calibratedPool) vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, calibratedPool, 2);
+                
+                vkEndCommandBuffer(cmd);
+            }
+        }
+    }
+    if (!useCpuTiming && Bench().timestampPeriod == 0) {
+        Log("[WARNING] GPU timestamps not supported - falling back to CPU timing");
+    }
+
+    // Runs `count` more batches with the selected timing method, appending to
+    // bandwidths. Returns false once the test should stop (abort or error).
+    auto runBatches = [&](int count) -> bool {
+        if (useCpuTiming) {
+            for (int i = 0; i < count; ++i) {
+                if (roundtripCmd.empty() || ShouldAbortBenchmark()) return false;
+                if (i % 8 == 0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
                 }
                 
-                vkEndCommandBuffer(g_app.benchCommandBuffer);
+                if (calibratedPool && HostMonotonicRawNs() - Bench().calibration.lastHostNs >= Constants::CALIBRATION_INTERVAL_NS) {
+                    UpdateClockCalibration();
+                }
 
                 // Start CPU timer
                 auto startTime = std::chrono::high_resolution_clock::now();
+                const uint64_t hostSubmitNs = HostMonotonicRawNs();
                 
-                VkSubmitInfo submitInfo = {};
-                submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &g_app.benchCommandBuffer;
-                vkQueueSubmit(g_app.benchQueue, 1, &submitInfo, g_app.benchFence);
-                
-                FenceWaitResult fenceResult = WaitForBenchFenceEx();
+                FenceWaitResult fenceResult = SubmitAndWait(roundtripCmd.data(), static_cast<uint32_t>(roundtripCmd.size()));
                 
+                const uint64_t hostWakeNs = HostMonotonicRawNs();
                 auto endTime = std::chrono::high_resolution_clock::now();
                 
-                if (fenceResult == FenceWaitResult::Cancelled) break;
+                if (fenceResult == FenceWaitResult::Cancelled) return false;
                 if (fenceResult == FenceWaitResult::Error || g_app.benchmarkAborted) {
                     Log("[ERROR] Critical fence error - aborting bandwidth test");
-                    break;
+                    return false;
+                }
+
+                if (calibratedPool) {
+                    // Upload interval straight off the host timeline
+                    double uploadSeconds = 0;
+                    if (ReadCalibratedRoundTrip(calibratedPool, hostSubmitNs, hostWakeNs, result.timeline, uploadSeconds)) {
+                        bandwidths.push_back(static_cast<double>(size) * copies / (1024.0 * 1024.0 * 1024.0) / uploadSeconds);
+                    } else {
+                        failedBatches++;
+                    }
+                    g_app.progress = static_cast<float>(i + 1) / static_cast<float>(count);
+                    continue;
                 }
 
                 double totalSeconds = std::chrono::duration<double>(endTime - startTime).count();
@@ -3032,43 +4922,26 @@ BenchmarkResult RunBandwidthTest(const std::string& name, VkBufferAllocation& sr
                     failedBatches++;
                 }
 
-                g_app.progress = static_cast<float>(i + 1) / static_cast<float>(batches);
+                g_app.progress = static_cast<float>(i + 1) / static_cast<float>(count);
             }
-            roundtripReadback.Destroy(g_app.benchDevice);
+            return true;
         }
-    }
-    
-    if (!useCpuTiming) {
-        // GPU timestamp mode
-        if (g_app.benchTimestampPeriod == 0) {
-            Log("[WARNING] GPU timestamps not supported - falling back to CPU timing");
+
+        if (Bench().timestampPeriod == 0) {
             // Fall back to simple CPU timing without round-trip
-            for (int i = 0; i < batches && !ShouldAbortBenchmark(); ++i) {
+            for (int i = 0; i < count; ++i) {
+                if (ShouldAbortBenchmark()) return false;
                 if (i % 8 == 0) {
                     std::this_thread::sleep_for(std::chrono::microseconds(100));
                 }
                 
-                BeginBenchCommandBuffer();
-                for (int j = 0; j < copies; ++j) {
-                    VkBufferCopy copyRegion = {};
-                    copyRegion.size = size;
-                    vkCmdCopyBuffer(g_app.benchCommandBuffer, src.buffer, dst.buffer, 1, &copyRegion);
-                }
-                vkEndCommandBuffer(g_app.benchCommandBuffer);
-
                 auto startTime = std::chrono::high_resolution_clock::now();
                 
-                VkSubmitInfo submitInfo = {};
-                submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &g_app.benchCommandBuffer;
-                vkQueueSubmit(g_app.benchQueue, 1, &submitInfo, g_app.benchFence);
-                
-                FenceWaitResult fenceResult = WaitForBenchFenceEx();
+                FenceWaitResult fenceResult = SubmitAndWait(copyCmd.data(), 1);
                 auto endTime = std::chrono::high_resolution_clock::now();
                 
-                if (fenceResult == FenceWaitResult::Cancelled) break;
-                if (fenceResult == FenceWaitResult::Error || g_app.benchmarkAborted) break;
+                if (fenceResult == FenceWaitResult::Cancelled) return false;
+                if (fenceResult == FenceWaitResult::Error || g_app.benchmarkAborted) return false;
 
                 double seconds = std::chrono::duration<double>(endTime - startTime).count();
                 if (seconds > 0) {
@@ -3077,96 +4950,42 @@ BenchmarkResult RunBandwidthTest(const std::string& name, VkBufferAllocation& sr
                 } else {
                     failedBatches++;
                 }
-                g_app.progress = static_cast<float>(i + 1) / static_cast<float>(batches);
-            }
-        } else {
-            // Create timestamp query pool
-            VkQueryPoolCreateInfo queryPoolInfo = {};
-            queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
-            queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
-            queryPoolInfo.queryCount = 2;
-            
-            VkQueryPool queryPool = VK_NULL_HANDLE;
-            if (vkCreateQueryPool(g_app.benchDevice, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
-                Log("[ERROR] Failed to create timestamp query pool in bandwidth test");
-                return result;
-            }
-
-            for (int i = 0; i < batches && !ShouldAbortBenchmark(); ++i) {
-                if (i % 8 == 0) {
-                    std::this_thread::sleep_for(std::chrono::microseconds(100));
-                }
-                
-                BeginBenchCommandBuffer();
-                
-                vkCmdResetQueryPool(g_app.benchCommandBuffer, queryPool, 0, 2);
-                // TOP_OF_PIPE is correct here: this is the first command in a fresh
-                // command buffer, so there's no prior work to wait for.
-                // D3D12 equivalent: EndQuery(TIMESTAMP) as first command in list.
-                vkCmdWriteTimestamp(g_app.benchCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, 0);
-                
-                for (int j = 0; j < copies; ++j) {
-                    VkBufferCopy copyRegion = {};
-                    copyRegion.size = size;
-                    vkCmdCopyBuffer(g_app.benchCommandBuffer, src.buffer, dst.buffer, 1, &copyRegion);
-                }
-                
-                vkCmdWriteTimestamp(g_app.benchCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, 1);
-                
-                vkEndCommandBuffer(g_app.benchCommandBuffer);
-
-                VkSubmitInfo submitInfo = {};
-                submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-                submitInfo.commandBufferCount = 1;
-                submitInfo.pCommandBuffers = &g_app.benchCommandBuffer;
-                vkQueueSubmit(g_app.benchQueue, 1, &submitInfo, g_app.benchFence);
-                
-                FenceWaitResult fenceResult = WaitForBenchFenceEx();
-                if (fenceResult == FenceWaitResult::Cancelled) break;
-                if (fenceResult == FenceWaitResult::Error || g_app.benchmarkAborted) {
-                    Log("[ERROR] Critical fence error - aborting bandwidth test");
-                    break;
-                }
-
-                uint64_t timestamps[2] = {};
-                VkResult qr = vkGetQueryPoolResults(g_app.benchDevice, queryPool, 0, 2,
-                    sizeof(timestamps), timestamps, sizeof(uint64_t),
-                    VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
-                
-                if (qr == VK_SUCCESS && timestamps[1] > timestamps[0]) {
-                    uint64_t delta = timestamps[1] - timestamps[0];
-                    double seconds = static_cast<double>(delta) * static_cast<double>(g_app.benchTimestampPeriod) / 1e9;
-                    if (seconds > 0) {
-                        double bw = (static_cast<double>(size) * copies / (1024.0 * 1024.0 * 1024.0)) / seconds;
-                        bandwidths.push_back(bw);
-                    } else {
-                        failedBatches++;
-                    }
-                } else {
-                    failedBatches++;
-                }
-
-                g_app.progress = static_cast<float>(i + 1) / static_cast<float>(batches);
+                g_app.progress = static_cast<float>(i + 1) / static_cast<float>(count);
             }
-            
-            vkDestroyQueryPool(g_app.benchDevice, queryPool, nullptr);
+            return true;
         }
-    }
 
-    if (!bandwidths.empty()) {
-        std::sort(bandwidths.begin(), bandwidths.end());
-        result.minValue = bandwidths.front();
-        result.maxValue = bandwidths.back();
-        result.avgValue = std::accumulate(bandwidths.begin(), bandwidths.end(), 0.0) / bandwidths.size();
-        result.samples = std::move(bandwidths);
-        
-        if (failedBatches > 0) {
-            Log("[WARNING] " + std::to_string(failedBatches) + " batches failed in " + name);
-        }
-    } else {
-        Log("[WARNING] No valid samples collected for " + name);
-    }
+        // GPU timestamp mode
+        const double batchGB = static_cast<double>(size) * copies / (1024.0 * 1024.0 * 1024.0);
+        auto record = [&](VkCommandBuffer cmd) { RecordBenchCopies(cmd, src.buffer, dst.buffer, size, copies); };
+        return RunTimestampedBatches(name, record, batchGB, count, bandwidths, failedBatches, !adaptive) &&
+               !ShouldAbortBenchmark();
+    };
 
+    if (adaptive) {
+        RunAdaptiveSampling(result, bandwidths, runBatches);
+    } else {
+        runBatches(batches);
+    }
+
+    FreeBenchCommandBuffers(roundtripCmd);
+    if (calibratedPool) vkDestroyQueryPool(Bench().device, calibratedPool, nullptr);
+    if (useCpuTiming && !roundtripBuffer) roundtripReadback.Destroy(Bench().device);
+    FreeBenchCommandBuffers(copyCmd);
+
+    HostTimeline& timeline = result.timeline;
+    if (timeline.samples > 0) {
+        timeline.submitToStartUs /= timeline.samples;
+        timeline.transferUs /= timeline.samples;
+        timeline.wakeupUs /= timeline.samples;
+        char buf[200];
+        snprintf(buf, sizeof(buf), "submit->start %.1f us, upload %.1f us, completion->wake %.1f us (%d rejected)",
+                 timeline.submitToStartUs, timeline.transferUs, timeline.wakeupUs, timeline.rejected);
+        Log("[INFO] " + name + " host timeline: " + buf);
+    } else if (timeline.rejected > 0) {
+        Log("[WARNING] " + name + ": every calibrated sample fell outside its submit/wake-up window");
+    }
+    SummarizeBandwidthSamples(result, bandwidths, failedBatches);
     return result;
 }
 
@@ -3175,7 +4994,7 @@ BenchmarkResult RunBandwidthTest(const std::string& name, VkBufferAllocation& sr
 // overlapping measurements. Each copy is individually timed within batches of 64.
 // D3D12 equivalent: EndQuery(TIMESTAMP) before/after each CopyResource on COPY queue.
 BenchmarkResult RunLatencyTest(const std::string& name, VkBufferAllocation& src, VkBufferAllocation& dst, int iterations) {
-    g_app.currentTest = name;
+    SetCurrentTest(name);
     BenchmarkResult result;
     result.testName = name;
     result.unit = "us";
@@ -3190,7 +5009,7 @@ BenchmarkResult RunLatencyTest(const std::string& name, VkBufferAllocation& src,
     constexpr int QueriesPerBatch = 64;
     int batchCount = (iterations + QueriesPerBatch - 1) / QueriesPerBatch;
 
-    if (g_app.benchTimestampPeriod == 0) {
+    if (Bench().timestampPeriod == 0) {
         Log("[WARNING] GPU timestamps not supported - latency test requires timestamps");
         return result;
     }
@@ -3201,44 +5020,59 @@ BenchmarkResult RunLatencyTest(const std::string& name, VkBufferAllocation& src,
     queryPoolInfo.queryCount = QueriesPerBatch * 2;
     
     VkQueryPool queryPool = VK_NULL_HANDLE;
-    if (vkCreateQueryPool(g_app.benchDevice, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
+    if (vkCreateQueryPool(Bench().device, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
         Log("[ERROR] Failed to create timestamp query pool");
         return result;
     }
 
-    std::vector<double> latencies;
-    latencies.reserve(iterations);
+    // Recorded once: [query reset, full batch, final partial batch]
+    const int tailOps = iterations % QueriesPerBatch;
+    std::vector<VkCommandBuffer> cmds = AllocateBenchCommandBuffers(3);
+    if (cmds.empty()) {
+        vkDestroyQueryPool(Bench().device, queryPool, nullptr);
+        return result;
+    }
+    BeginReusableCommandBuffer(cmds[0]);
+    vkCmdResetQueryPool(cmds[0], queryPool, 0, QueriesPerBatch * 2);
+    vkEndCommandBuffer(cmds[0]);
 
-    for (int b = 0; b < batchCount && !ShouldAbortBenchmark(); ++b) {
-        if (b % 4 == 0) {
-            std::this_thread::sleep_for(std::chrono::microseconds(50));
-        }
-        
-        int opsThisBatch = std::min(QueriesPerBatch, iterations - static_cast<int>(latencies.size()));
-
-        BeginBenchCommandBuffer();
-        
-        vkCmdResetQueryPool(g_app.benchCommandBuffer, queryPool, 0, opsThisBatch * 2);
-
-        for (int i = 0; i < opsThisBatch; ++i) {
+    auto recordBatch = [&](VkCommandBuffer cmd, int ops) {
+        BeginReusableCommandBuffer(cmd);
+        for (int i = 0; i < ops; ++i) {
             uint32_t queryIndex = i * 2;
             // BOTTOM_OF_PIPE for both timestamps = serialized measurement.
             // D3D12 equivalent: EndQuery(TIMESTAMP) which also serializes.
-            vkCmdWriteTimestamp(g_app.benchCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex);
+            vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex);
             
             VkBufferCopy copyRegion = {};
             copyRegion.size = src.size;
-            vkCmdCopyBuffer(g_app.benchCommandBuffer, src.buffer, dst.buffer, 1, &copyRegion);
+            vkCmdCopyBuffer(cmd, src.buffer, dst.buffer, 1, &copyRegion);
             
-            vkCmdWriteTimestamp(g_app.benchCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex + 1);
+            vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex + 1);
+        }
+        vkEndCommandBuffer(cmd);
+    };
+    recordBatch(cmds[1], QueriesPerBatch);
+    if (tailOps > 0) recordBatch(cmds[2], tailOps);
+
+    std::vector<double> latencies;
+    latencies.reserve(iterations);
+
+    for (int b = 0; b < batchCount && !ShouldAbortBenchmark(); ++b) {
+        if (b % 4 == 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
         }
+        
+        const bool tail = (b == batchCount - 1) && tailOps > 0;
+        int opsThisBatch = tail ? tailOps : QueriesPerBatch;
 
-        FenceWaitResult fenceResult = EndAndSubmitBenchCommandBuffer();
+        VkCommandBuffer submit[2] = { cmds[0], tail ? cmds[2] : cmds[1] };
+        FenceWaitResult fenceResult = SubmitAndWait(submit, 2);
         if (fenceResult == FenceWaitResult::Cancelled || g_app.benchmarkAborted) break;
 
         // Read timestamps
         std::vector<uint64_t> timestamps(opsThisBatch * 2);
-        VkResult qr = vkGetQueryPoolResults(g_app.benchDevice, queryPool, 0, opsThisBatch * 2,
+        VkResult qr = vkGetQueryPoolResults(Bench().device, queryPool, 0, opsThisBatch * 2,
             timestamps.size() * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t),
             VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
         
@@ -3247,9 +5081,10 @@ BenchmarkResult RunLatencyTest(const std::string& name, VkBufferAllocation& src,
                 uint64_t tStart = timestamps[i * 2 + 0];
                 uint64_t tEnd = timestamps[i * 2 + 1];
                 if (tEnd > tStart) {
-                    double deltaSec = static_cast<double>(tEnd - tStart) * static_cast<double>(g_app.benchTimestampPeriod) / 1e9;
+                    double deltaSec = static_cast<double>(tEnd - tStart) * static_cast<double>(Bench().timestampPeriod) / 1e9;
                     double us = deltaSec * 1'000'000.0;
                     latencies.push_back(us);
+                    result.histogram.Record(us);
                 }
             }
         } else {
@@ -3269,7 +5104,8 @@ BenchmarkResult RunLatencyTest(const std::string& name, VkBufferAllocation& src,
         Log("[WARNING] No valid latency samples collected for " + name);
     }
 
-    vkDestroyQueryPool(g_app.benchDevice, queryPool, nullptr);
+    FreeBenchCommandBuffers(cmds);
+    vkDestroyQueryPool(Bench().device, queryPool, nullptr);
     return result;
 }
 
@@ -3277,14 +5113,14 @@ BenchmarkResult RunLatencyTest(const std::string& name, VkBufferAllocation& src,
 // Back-to-back timestamp pairs with no work between them.
 // D3D12 equivalent: consecutive EndQuery(TIMESTAMP) pairs on COPY queue.
 BenchmarkResult RunCommandLatencyTest(int iterations) {
-    g_app.currentTest = "Command Latency";
+    SetCurrentTest("Command Latency");
     BenchmarkResult result;
     result.testName = "Command Latency";
     result.unit = "us";
 
     if (iterations <= 0) return result;
 
-    if (g_app.benchTimestampPeriod == 0) {
+    if (Bench().timestampPeriod == 0) {
         Log("[WARNING] GPU timestamps not supported - command latency test requires timestamps");
         return result;
     }
@@ -3298,11 +5134,34 @@ BenchmarkResult RunCommandLatencyTest(int iterations) {
     queryPoolInfo.queryCount = QueriesPerBatch * 2;
     
     VkQueryPool queryPool = VK_NULL_HANDLE;
-    if (vkCreateQueryPool(g_app.benchDevice, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
+    if (vkCreateQueryPool(Bench().device, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
         Log("[ERROR] Failed to create timestamp query pool for command latency");
         return result;
     }
 
+    // Recorded once: [query reset, full batch, final partial batch]
+    const int tailOps = iterations % QueriesPerBatch;
+    std::vector<VkCommandBuffer> cmds = AllocateBenchCommandBuffers(3);
+    if (cmds.empty()) {
+        vkDestroyQueryPool(Bench().device, queryPool, nullptr);
+        return result;
+    }
+    BeginReusableCommandBuffer(cmds[0]);
+    vkCmdResetQueryPool(cmds[0], queryPool, 0, QueriesPerBatch * 2);
+    vkEndCommandBuffer(cmds[0]);
+
+    auto recordBatch = [&](VkCommandBuffer cmd, int ops) {
+        BeginReusableCommandBuffer(cmd);
+        for (int i = 0; i < ops; ++i) {
+            uint32_t queryIndex = i * 2;
+            vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex);
+            vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex + 1);
+        }
+        vkEndCommandBuffer(cmd);
+    };
+    recordBatch(cmds[1], QueriesPerBatch);
+    if (tailOps > 0) recordBatch(cmds[2], tailOps);
+
     std::vector<double> latencies;
     latencies.reserve(iterations);
 
@@ -3311,23 +5170,15 @@ BenchmarkResult RunCommandLatencyTest(int iterations) {
             std::this_thread::sleep_for(std::chrono::microseconds(50));
         }
         
-        int opsThisBatch = std::min(QueriesPerBatch, iterations - static_cast<int>(latencies.size()));
+        const bool tail = (b == batchCount - 1) && tailOps > 0;
+        int opsThisBatch = tail ? tailOps : QueriesPerBatch;
 
-        BeginBenchCommandBuffer();
-        
-        vkCmdResetQueryPool(g_app.benchCommandBuffer, queryPool, 0, opsThisBatch * 2);
-
-        for (int i = 0; i < opsThisBatch; ++i) {
-            uint32_t queryIndex = i * 2;
-            vkCmdWriteTimestamp(g_app.benchCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex);
-            vkCmdWriteTimestamp(g_app.benchCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, queryIndex + 1);
-        }
-
-        FenceWaitResult fenceResult = EndAndSubmitBenchCommandBuffer();
+        VkCommandBuffer submit[2] = { cmds[0], tail ? cmds[2] : cmds[1] };
+        FenceWaitResult fenceResult = SubmitAndWait(submit, 2);
         if (fenceResult == FenceWaitResult::Cancelled || g_app.benchmarkAborted) break;
 
         std::vector<uint64_t> timestamps(opsThisBatch * 2);
-        VkResult qr = vkGetQueryPoolResults(g_app.benchDevice, queryPool, 0, opsThisBatch * 2,
+        VkResult qr = vkGetQueryPoolResults(Bench().device, queryPool, 0, opsThisBatch * 2,
             timestamps.size() * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t),
             VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
         
@@ -3335,9 +5186,10 @@ BenchmarkResult RunCommandLatencyTest(int iterations) {
             for (int i = 0; i < opsThisBatch; ++i) {
                 uint64_t tStart = timestamps[i * 2 + 0];
                 uint64_t tEnd = timestamps[i * 2 + 1];
-                double deltaSec = static_cast<double>(tEnd - tStart) * static_cast<double>(g_app.benchTimestampPeriod) / 1e9;
+                double deltaSec = static_cast<double>(tEnd - tStart) * static_cast<double>(Bench().timestampPeriod) / 1e9;
                 double us = deltaSec * 1'000'000.0;
                 latencies.push_back(us);
+                result.histogram.Record(us);
             }
         }
 
@@ -3354,7 +5206,8 @@ BenchmarkResult RunCommandLatencyTest(int iterations) {
         Log("[WARNING] No valid command latency samples collected");
     }
 
-    vkDestroyQueryPool(g_app.benchDevice, queryPool, nullptr);
+    FreeBenchCommandBuffers(cmds);
+    vkDestroyQueryPool(Bench().device, queryPool, nullptr);
     return result;
 }
 
@@ -3364,75 +5217,58 @@ BenchmarkResult RunCommandLatencyTest(int iterations) {
 // CPU wall-clock timing measures total elapsed time; both directions counted.
 // Falls back to single-queue interleaved copies if dual queues unavailable.
 // D3D12 equivalent: 2 × COPY queues with simultaneous ExecuteCommandLists.
-BenchmarkResult RunBidirectionalTest(size_t size, int copies, int batches) {
-    g_app.currentTest = "Bidirectional " + FormatSize(size);
+// Buffers may be larger than size: the first `size` bytes of each are copied.
+BenchmarkResult RunBidirectionalTest(VkBufferAllocation& cpuUpload, VkBufferAllocation& gpuDefault,
+                                     VkBufferAllocation& gpuSrc, VkBufferAllocation& cpuReadback,
+                                     size_t size, int copies, int batches) {
     BenchmarkResult result;
-    result.testName = g_app.currentTest;
+    result.testName = "Bidirectional " + FormatSize(size);
+    SetCurrentTest(result.testName);
     result.unit = "GB/s";
 
-    auto cpuUpload = CreateBuffer(VkBufferType::Upload, size);
-    auto gpuDefault = CreateBuffer(VkBufferType::DeviceLocal, size);
-    auto gpuSrc = CreateBuffer(VkBufferType::DeviceLocal, size);
-    auto cpuReadback = CreateBuffer(VkBufferType::Readback, size);
-
-    if (!cpuUpload || !gpuDefault || !gpuSrc || !cpuReadback) {
-        Log("[ERROR] Failed to create resources for bidirectional test - likely out of VRAM");
-        cpuUpload.Destroy(g_app.benchDevice);
-        gpuDefault.Destroy(g_app.benchDevice);
-        gpuSrc.Destroy(g_app.benchDevice);
-        cpuReadback.Destroy(g_app.benchDevice);
-        return result;
-    }
-
     std::vector<double> bandwidths;
     bandwidths.reserve(batches);
     
-    // Warm-up pass - uses same queue topology as the actual test
-    if (g_app.hasDualQueues) {
-        VkBufferCopy copyRegion = {};
-        copyRegion.size = size;
-        VkCommandBufferBeginInfo beginInfo = {};
-        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        
-        // Warm-up: upload on queue 1
-        vkResetCommandBuffer(g_app.benchCommandBuffer, 0);
-        vkBeginCommandBuffer(g_app.benchCommandBuffer, &beginInfo);
-        for (int j = 0; j < copies; ++j)
-            vkCmdCopyBuffer(g_app.benchCommandBuffer, cpuUpload.buffer, gpuDefault.buffer, 1, &copyRegion);
-        vkEndCommandBuffer(g_app.benchCommandBuffer);
-        
-        // Warm-up: download on queue 2
-        vkResetCommandBuffer(g_app.benchCommandBuffer2, 0);
-        vkBeginCommandBuffer(g_app.benchCommandBuffer2, &beginInfo);
-        for (int j = 0; j < copies; ++j)
-            vkCmdCopyBuffer(g_app.benchCommandBuffer2, gpuSrc.buffer, cpuReadback.buffer, 1, &copyRegion);
-        vkEndCommandBuffer(g_app.benchCommandBuffer2);
+    // Both directions are recorded once and resubmitted for the warm-up and
+    // every batch: upload into command buffer 1, download into command buffer 2
+    // (dual queues), or interleaved into command buffer 1 (single queue).
+    vkResetCommandBuffer(Bench().commandBuffer, 0);
+    BeginReusableCommandBuffer(Bench().commandBuffer);
+    if (Bench().hasDualQueues) {
+        RecordBenchCopies(Bench().commandBuffer, cpuUpload.buffer, gpuDefault.buffer, size, copies);
+        vkEndCommandBuffer(Bench().commandBuffer);
         
+        vkResetCommandBuffer(Bench().commandBuffer2, 0);
+        BeginReusableCommandBuffer(Bench().commandBuffer2);
+        RecordBenchCopies(Bench().commandBuffer2, gpuSrc.buffer, cpuReadback.buffer, size, copies);
+        vkEndCommandBuffer(Bench().commandBuffer2);
+    } else {
+        for (int j = 0; j < copies; ++j) {
+            RecordBenchCopies(Bench().commandBuffer, cpuUpload.buffer, gpuDefault.buffer, size, 1);
+            RecordBenchCopies(Bench().commandBuffer, gpuSrc.buffer, cpuReadback.buffer, size, 1);
+        }
+        vkEndCommandBuffer(Bench().commandBuffer);
+    }
+    
+    // Warm-up pass - uses same queue topology as the actual test
+    if (Bench().hasDualQueues) {
         VkSubmitInfo si1 = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
         si1.commandBufferCount = 1;
-        si1.pCommandBuffers = &g_app.benchCommandBuffer;
+        si1.pCommandBuffers = &Bench().commandBuffer;
         VkSubmitInfo si2 = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
         si2.commandBufferCount = 1;
-        si2.pCommandBuffers = &g_app.benchCommandBuffer2;
+        si2.pCommandBuffers = &Bench().commandBuffer2;
         
-        vkQueueSubmit(g_app.benchQueue, 1, &si1, g_app.benchFence);
-        vkQueueSubmit(g_app.benchQueue2, 1, &si2, g_app.benchFence2);
-        VkFence warmupFences[2] = { g_app.benchFence, g_app.benchFence2 };
-        vkWaitForFences(g_app.benchDevice, 2, warmupFences, VK_TRUE, UINT64_MAX);
-        vkResetFences(g_app.benchDevice, 2, warmupFences);
+        vkQueueSubmit(Bench().queue, 1, &si1, Bench().fence);
+        vkQueueSubmit(Bench().queue2, 1, &si2, Bench().fence2);
+        VkFence warmupFences[2] = { Bench().fence, Bench().fence2 };
+        vkWaitForFences(Bench().device, 2, warmupFences, VK_TRUE, UINT64_MAX);
+        vkResetFences(Bench().device, 2, warmupFences);
     } else {
-        BeginBenchCommandBuffer();
-        VkBufferCopy copyRegion = {};
-        copyRegion.size = size;
-        for (int j = 0; j < copies; ++j) {
-            vkCmdCopyBuffer(g_app.benchCommandBuffer, cpuUpload.buffer, gpuDefault.buffer, 1, &copyRegion);
-            vkCmdCopyBuffer(g_app.benchCommandBuffer, gpuSrc.buffer, cpuReadback.buffer, 1, &copyRegion);
-        }
-        EndAndSubmitBenchCommandBuffer();
+        SubmitAndWait();
     }
 
-    if (g_app.hasDualQueues) {
+    if (Bench().hasDualQueues) {
         // ---- DUAL QUEUE PATH: true simultaneous upload + download ----
         // Queue 1 handles upload, Queue 2 handles download.
         // D3D12 backport: 2 × COPY queues, one for upload, one for download.
@@ -3442,56 +5278,34 @@ BenchmarkResult RunBidirectionalTest(size_t size, int copies, int batches) {
                 std::this_thread::sleep_for(std::chrono::microseconds(100));
             }
             
-            VkBufferCopy copyRegion = {};
-            copyRegion.size = size;
-            
-            // Record upload commands into command buffer 1
-            vkResetCommandBuffer(g_app.benchCommandBuffer, 0);
-            VkCommandBufferBeginInfo beginInfo = {};
-            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            vkBeginCommandBuffer(g_app.benchCommandBuffer, &beginInfo);
-            for (int j = 0; j < copies; ++j) {
-                vkCmdCopyBuffer(g_app.benchCommandBuffer, cpuUpload.buffer, gpuDefault.buffer, 1, &copyRegion);
-            }
-            vkEndCommandBuffer(g_app.benchCommandBuffer);
-            
-            // Record download commands into command buffer 2
-            vkResetCommandBuffer(g_app.benchCommandBuffer2, 0);
-            vkBeginCommandBuffer(g_app.benchCommandBuffer2, &beginInfo);
-            for (int j = 0; j < copies; ++j) {
-                vkCmdCopyBuffer(g_app.benchCommandBuffer2, gpuSrc.buffer, cpuReadback.buffer, 1, &copyRegion);
-            }
-            vkEndCommandBuffer(g_app.benchCommandBuffer2);
-            
             // Submit both simultaneously to separate queues
             VkSubmitInfo submitInfo1 = {};
             submitInfo1.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
             submitInfo1.commandBufferCount = 1;
-            submitInfo1.pCommandBuffers = &g_app.benchCommandBuffer;
+            submitInfo1.pCommandBuffers = &Bench().commandBuffer;
             
             VkSubmitInfo submitInfo2 = {};
             submitInfo2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
             submitInfo2.commandBufferCount = 1;
-            submitInfo2.pCommandBuffers = &g_app.benchCommandBuffer2;
+            submitInfo2.pCommandBuffers = &Bench().commandBuffer2;
             
             auto startTime = std::chrono::high_resolution_clock::now();
             
-            vkQueueSubmit(g_app.benchQueue, 1, &submitInfo1, g_app.benchFence);
-            vkQueueSubmit(g_app.benchQueue2, 1, &submitInfo2, g_app.benchFence2);
+            vkQueueSubmit(Bench().queue, 1, &submitInfo1, Bench().fence);
+            vkQueueSubmit(Bench().queue2, 1, &submitInfo2, Bench().fence2);
             
             // Wait for both to complete
-            VkFence fences[2] = { g_app.benchFence, g_app.benchFence2 };
+            VkFence fences[2] = { Bench().fence, Bench().fence2 };
             uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL;
-            VkResult waitResult = vkWaitForFences(g_app.benchDevice, 2, fences, VK_TRUE, timeout);
+            VkResult waitResult = vkWaitForFences(Bench().device, 2, fences, VK_TRUE, timeout);
             
             auto endTime = std::chrono::high_resolution_clock::now();
             
-            vkResetFences(g_app.benchDevice, 2, fences);
+            vkResetFences(Bench().device, 2, fences);
             
             if (waitResult == VK_TIMEOUT) {
-                g_app.fenceTimeoutCount++;
-                if (g_app.fenceTimeoutCount >= Constants::MAX_FENCE_RETRIES) {
+                Bench().fenceTimeoutCount++;
+                if (Bench().fenceTimeoutCount >= Constants::MAX_FENCE_RETRIES) {
                     g_app.benchmarkAborted = true;
                     break;
                 }
@@ -3500,7 +5314,7 @@ BenchmarkResult RunBidirectionalTest(size_t size, int copies, int batches) {
                 break;
             }
             
-            g_app.fenceTimeoutCount = 0;
+            Bench().fenceTimeoutCount = 0;
             
             double seconds = std::chrono::duration<double>(endTime - startTime).count();
             if (seconds > 0) {
@@ -3517,24 +5331,9 @@ BenchmarkResult RunBidirectionalTest(size_t size, int copies, int batches) {
                 std::this_thread::sleep_for(std::chrono::microseconds(100));
             }
             
-            BeginBenchCommandBuffer();
-            VkBufferCopy copyRegion = {};
-            copyRegion.size = size;
-            for (int j = 0; j < copies; ++j) {
-                vkCmdCopyBuffer(g_app.benchCommandBuffer, cpuUpload.buffer, gpuDefault.buffer, 1, &copyRegion);
-                vkCmdCopyBuffer(g_app.benchCommandBuffer, gpuSrc.buffer, cpuReadback.buffer, 1, &copyRegion);
-            }
-            vkEndCommandBuffer(g_app.benchCommandBuffer);
-
             auto startTime = std::chrono::high_resolution_clock::now();
             
-            VkSubmitInfo submitInfo = {};
-            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-            submitInfo.commandBufferCount = 1;
-            submitInfo.pCommandBuffers = &g_app.benchCommandBuffer;
-            vkQueueSubmit(g_app.benchQueue, 1, &submitInfo, g_app.benchFence);
-            
-            FenceWaitResult fenceResult = WaitForBenchFenceEx();
+            FenceWaitResult fenceResult = SubmitAndWait();
             auto endTime = std::chrono::high_resolution_clock::now();
             
             if (fenceResult == FenceWaitResult::Cancelled || g_app.benchmarkAborted) break;
@@ -3559,19 +5358,356 @@ BenchmarkResult RunBidirectionalTest(size_t size, int copies, int batches) {
         Log("[WARNING] No valid bidirectional samples collected");
     }
 
-    cpuUpload.Destroy(g_app.benchDevice);
-    gpuDefault.Destroy(g_app.benchDevice);
-    gpuSrc.Destroy(g_app.benchDevice);
-    cpuReadback.Destroy(g_app.benchDevice);
+    return result;
+}
+
+BenchmarkResult RunBidirectionalTest(size_t size, int copies, int batches) {
+    auto cpuUpload = CreateBuffer(VkBufferType::Upload, size);
+    auto gpuDefault = CreateBuffer(VkBufferType::DeviceLocal, size);
+    auto gpuSrc = CreateBuffer(VkBufferType::DeviceLocal, size);
+    auto cpuReadback = CreateBuffer(VkBufferType::Readback, size);
+
+    BenchmarkResult result;
+    if (!cpuUpload || !gpuDefault || !gpuSrc || !cpuReadback) {
+        Log("[ERROR] Failed to create resources for bidirectional test - likely out of VRAM");
+        result.testName = "Bidirectional " + FormatSize(size);
+        result.unit = "GB/s";
+    } else {
+        result = RunBidirectionalTest(cpuUpload, gpuDefault, gpuSrc, cpuReadback, size, copies, batches);
+    }
+
+    cpuUpload.Destroy(Bench().device);
+    gpuDefault.Destroy(Bench().device);
+    gpuSrc.Destroy(Bench().device);
+    cpuReadback.Destroy(Bench().device);
 
     return result;
 }
 
+// ----------------------------------------------------------------------------
+// Transfer-size sweep
+// ----------------------------------------------------------------------------
+// Upload, download and bidirectional bandwidth over SWEEP_MIN_SIZE..
+// SWEEP_MAX_SIZE, doubling. One set of buffers is allocated at the largest
+// size and every point copies a sub-range from offset 0.
+
+// N½: the transfer size at which bandwidth first reaches half of the sweep's
+// peak, interpolated on log2(size). 0 if the series has no samples.
+double HalfBandwidthSize(const std::vector<double>& sizes, const std::vector<double>& bandwidths) {
+    double peak = 0.0;
+    for (double bw : bandwidths) peak = std::max(peak, bw);
+    if (peak <= 0.0) return 0.0;
+
+    const double half = peak / 2.0;
+    double prevSize = 0.0, prevBw = 0.0;
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        if (bandwidths[i] <= 0.0) continue;  // Not measured
+        if (bandwidths[i] >= half) {
+            if (prevSize <= 0.0) return sizes[i];
+            double t = (half - prevBw) / (bandwidths[i] - prevBw);
+            return std::exp2(std::log2(prevSize) + t * (std::log2(sizes[i]) - std::log2(prevSize)));
+        }
+        prevSize = sizes[i];
+        prevBw = bandwidths[i];
+    }
+    return 0.0;
+}
+
+void RunSizeSweep(bool useRoundTrip) {
+    size_t maxSize = std::min(Constants::SWEEP_MAX_SIZE, GetSafeMaxBandwidthSize(g_app.config.selectedGPU));
+    Log("--- Transfer-size sweep: " + FormatSize(Constants::SWEEP_MIN_SIZE) + " - " + FormatSize(maxSize) + " ---");
+
+    auto cpuUpload = CreateBuffer(VkBufferType::Upload, maxSize);
+    auto gpuDefault = CreateBuffer(VkBufferType::DeviceLocal, maxSize);
+    auto gpuSrc = CreateBuffer(VkBufferType::DeviceLocal, maxSize);
+    auto cpuReadback = CreateBuffer(VkBufferType::Readback, maxSize);
+
+    SizeSweepResult sweep;
+    if (!cpuUpload || !gpuDefault || !gpuSrc || !cpuReadback) {
+        Log("[CRITICAL] Failed to allocate sweep buffers - skipping transfer-size sweep");
+    } else {
+        const int copies = g_app.config.copiesPerBatch;
+        for (size_t size = Constants::SWEEP_MIN_SIZE; size <= maxSize && !ShouldAbortBenchmark(); size *= 2) {
+            // Keep the largest points to about SWEEP_BYTES_PER_POINT per direction
+            size_t batchBytes = size * static_cast<size_t>(copies);
+            int batches = static_cast<int>(std::min<size_t>(g_app.config.bandwidthBatches,
+                                                            Constants::SWEEP_BYTES_PER_POINT / batchBytes));
+            batches = std::max(batches, Constants::SWEEP_MIN_BATCHES);
+
+            // Fixed per-point byte budget: no adaptive sampling here
+            auto down = RunBandwidthTest("Sweep GPU->CPU " + FormatSize(size), gpuSrc, cpuReadback,
+                                         size, copies, batches, false, 0.0, nullptr, false);
+            if (ShouldAbortBenchmark()) break;
+            auto up = RunBandwidthTest("Sweep CPU->GPU " + FormatSize(size), cpuUpload, gpuDefault,
+                                       size, copies, batches, useRoundTrip, down.avgValue, &cpuReadback, false);
+            if (ShouldAbortBenchmark()) break;
+            BenchmarkResult bidir;
+            if (g_app.config.runBidirectional) {
+                bidir = RunBidirectionalTest(cpuUpload, gpuDefault, gpuSrc, cpuReadback, size, copies, batches);
+            }
+
+            sweep.sizes.push_back(static_cast<double>(size));
+            sweep.download.push_back(down.avgValue);
+            sweep.upload.push_back(up.avgValue);
+            sweep.bidirectional.push_back(bidir.avgValue);
+
+            char line[160];
+            snprintf(line, sizeof(line), "  %-8s CPU->GPU %7.2f  GPU->CPU %7.2f  Bidir %7.2f GB/s",
+                     FormatSize(size).c_str(), up.avgValue, down.avgValue, bidir.avgValue);
+            Log(line);
+        }
+
+        auto logHalf = [&](const char* label, const std::vector<double>& bw) {
+            double n = HalfBandwidthSize(sweep.sizes, bw);
+            if (n > 0.0) Log(std::string("  N1/2 ") + label + ": " + FormatSize(static_cast<size_t>(n)));
+        };
+        logHalf("CPU->GPU", sweep.upload);
+        logHalf("GPU->CPU", sweep.download);
+        logHalf("Bidirectional", sweep.bidirectional);
+    }
+
+    cpuUpload.Destroy(Bench().device);
+    gpuDefault.Destroy(Bench().device);
+    gpuSrc.Destroy(Bench().device);
+    cpuReadback.Destroy(Bench().device);
+
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.sizeSweep = std::move(sweep);
+}
+
+// ----------------------------------------------------------------------------
+// Multi-queue DMA scaling
+// ----------------------------------------------------------------------------
+// Splits one fixed transfer (bandwidthSize x copiesPerBatch) into n equal
+// slices copied on n queues at once, for n = 1 .. every queue the bench device
+// opened. Aggregate throughput is wall clock from the first submit to the
+// last fence; per-queue throughput comes from each queue's own timestamps.
+// An aggregate that stops growing means the extra queues share copy engines.
+//
+// The buffers are EXCLUSIVE and used from several families without ownership
+// transfers, which leaves their contents undefined - only throughput matters
+// here.
+
+// "T1.0" = transfer family 1, queue 0 (G = graphics, C = compute)
+std::string BenchQueueLabel(const BenchQueueRef& q) {
+    const char* kind = (q.flags & VK_QUEUE_GRAPHICS_BIT) ? "G" : (q.flags & VK_QUEUE_COMPUTE_BIT) ? "C" : "T";
+    return kind + std::to_string(q.family) + "." + std::to_string(q.index);
+}
+
+// Smallest queue count within QUEUE_SCALING_SATURATION of the best aggregate
+uint32_t SaturatingQueueCount(const std::vector<QueueScalingPoint>& points) {
+    double best = 0.0;
+    for (const auto& p : points) best = std::max(best, p.aggregate);
+    for (const auto& p : points) {
+        if (best > 0.0 && p.aggregate >= best * Constants::QUEUE_SCALING_SATURATION) return p.queueCount;
+    }
+    return 0;
+}
+
+void RunQueueScalingTest() {
+    const std::vector<BenchQueueRef>& queues = Bench().queues;
+    const uint32_t queueCount = static_cast<uint32_t>(queues.size());
+    const size_t total = g_app.config.bandwidthSize;
+    const int copies = g_app.config.copiesPerBatch;
+    const int batches = std::min(g_app.config.bandwidthBatches, Constants::QUEUE_SCALING_MAX_BATCHES);
+    if (queueCount == 0) return;
+
+    SetCurrentTest("Queue Scaling");
+    Log("--- Queue scaling: " + FormatSize(total) + " x " + std::to_string(copies) + " split over 1-" +
+        std::to_string(queueCount) + " queues ---");
+
+    QueueScalingResult scaling;
+    for (const auto& q : queues) scaling.queueLabels.push_back(BenchQueueLabel(q));
+
+    // One command pool per family, one command buffer and fence per queue
+    uint32_t familyCount = 0;
+    for (const auto& q : queues) familyCount = std::max(familyCount, q.family + 1);
+    std::vector<VkCommandPool> pools(familyCount, VK_NULL_HANDLE);
+    std::vector<VkCommandBuffer> cmds(queueCount, VK_NULL_HANDLE);
+    std::vector<VkFence> fences(queueCount, VK_NULL_HANDLE);
+    VkQueryPool queryPool = VK_NULL_HANDLE;
+
+    bool ok = true;
+    for (uint32_t i = 0; i < queueCount && ok; ++i) {
+        VkCommandPool& pool = pools[queues[i].family];
+        if (pool == VK_NULL_HANDLE) {
+            VkCommandPoolCreateInfo poolInfo = {};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            poolInfo.queueFamilyIndex = queues[i].family;
+            ok = vkCreateCommandPool(Bench().device, &poolInfo, nullptr, &pool) == VK_SUCCESS;
+            if (!ok) break;
+        }
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = pool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        VkFenceCreateInfo fenceInfo = {};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        ok = vkAllocateCommandBuffers(Bench().device, &allocInfo, &cmds[i]) == VK_SUCCESS &&
+             vkCreateFence(Bench().device, &fenceInfo, nullptr, &fences[i]) == VK_SUCCESS;
+    }
+    if (ok) {
+        VkQueryPoolCreateInfo queryPoolInfo = {};
+        queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolInfo.queryCount = queueCount * 2;
+        ok = vkCreateQueryPool(Bench().device, &queryPoolInfo, nullptr, &queryPool) == VK_SUCCESS;
+    }
+
+    auto cpuUpload = CreateBuffer(VkBufferType::Upload, total);
+    auto gpuBuffer = CreateBuffer(VkBufferType::DeviceLocal, total);
+    auto cpuReadback = CreateBuffer(VkBufferType::Readback, total);
+    if (!ok || !cpuUpload || !gpuBuffer || !cpuReadback) {
+        Log("[ERROR] Failed to create resources for queue scaling test");
+        ok = false;
+    }
+
+    // Submits the first n queues' command buffers and waits for all of them
+    auto submitAll = [&](uint32_t n, double& seconds) -> VkResult {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        uint32_t submitted = 0;
+        VkResult result = VK_SUCCESS;
+        for (; submitted < n && result == VK_SUCCESS; ++submitted) {
+            VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers = &cmds[submitted];
+            result = vkQueueSubmit(queues[submitted].queue, 1, &submitInfo, fences[submitted]);
+            if (result != VK_SUCCESS) break;
+        }
+        if (submitted == 0) return result;
+
+        uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL;
+        VkResult waitResult = vkWaitForFences(Bench().device, submitted, fences.data(), VK_TRUE, timeout);
+        seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+        if (waitResult == VK_SUCCESS) vkResetFences(Bench().device, submitted, fences.data());
+        return result != VK_SUCCESS ? result : waitResult;
+    };
+
+    const int totalSteps = 2 * static_cast<int>(queueCount) * batches;
+    int step = 0;
+
+    auto runDirection = [&](const char* label, VkBuffer src, VkBuffer dst, std::vector<QueueScalingPoint>& points) {
+        for (uint32_t n = 1; n <= queueCount && ok && !ShouldAbortBenchmark(); ++n) {
+            const size_t slice = total / n / Constants::QUEUE_SCALING_SLICE_ALIGN * Constants::QUEUE_SCALING_SLICE_ALIGN;
+            const double sliceGB = static_cast<double>(slice) * copies / (1024.0 * 1024.0 * 1024.0);
+
+            // Queue i copies slice i, bracketed by its own timestamp pair
+            for (uint32_t i = 0; i < n; ++i) {
+                vkResetCommandBuffer(cmds[i], 0);
+                BeginReusableCommandBuffer(cmds[i]);
+                if (queues[i].timestamps) {
+                    vkCmdResetQueryPool(cmds[i], queryPool, i * 2, 2);
+                    vkCmdWriteTimestamp(cmds[i], VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, i * 2);
+                }
+                VkBufferCopy region = {};
+                region.srcOffset = i * slice;
+                region.dstOffset = i * slice;
+                region.size = slice;
+                for (int j = 0; j < copies; ++j) {
+                    vkCmdCopyBuffer(cmds[i], src, dst, 1, &region);
+                }
+                if (queues[i].timestamps) {
+                    vkCmdWriteTimestamp(cmds[i], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, i * 2 + 1);
+                }
+                vkEndCommandBuffer(cmds[i]);
+            }
+
+            double seconds = 0.0;
+            VkResult warmup = submitAll(n, seconds);
+            if (warmup != VK_SUCCESS) {
+                Log(std::string("[ERROR] Queue scaling ") + label + " x" + std::to_string(n) +
+                    " failed: " + std::to_string((int)warmup));
+                ok = false;
+                break;
+            }
+
+            std::vector<double> aggregate;
+            std::vector<std::vector<double>> perQueue(n);
+            for (int b = 0; b < batches && !ShouldAbortBenchmark(); ++b) {
+                VkResult result = submitAll(n, seconds);
+                if (result != VK_SUCCESS) {
+                    Log(std::string("[ERROR] Queue scaling ") + label + " x" + std::to_string(n) +
+                        " failed: " + std::to_string((int)result));
+                    if (result == VK_TIMEOUT) Bench().fenceTimeoutCount++;
+                    ok = false;
+                    break;
+                }
+                if (seconds > 0) aggregate.push_back(sliceGB * n / seconds);
+
+                for (uint32_t i = 0; i < n; ++i) {
+                    if (!queues[i].timestamps) continue;
+                    uint64_t timestamps[2] = {};
+                    VkResult qr = vkGetQueryPoolResults(Bench().device, queryPool, i * 2, 2, sizeof(timestamps),
+                                                        timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+                    if (qr == VK_SUCCESS && timestamps[1] > timestamps[0]) {
+                        double queueSeconds = static_cast<double>(timestamps[1] - timestamps[0]) *
+                                              static_cast<double>(Bench().timestampPeriod) / 1e9;
+                        perQueue[i].push_back(sliceGB / queueSeconds);
+                    }
+                }
+                g_app.progress = static_cast<float>(++step) / static_cast<float>(totalSteps);
+            }
+            if (aggregate.empty()) break;
+
+            auto mean = [](const std::vector<double>& v) {
+                return v.empty() ? 0.0 : std::accumulate(v.begin(), v.end(), 0.0) / v.size();
+            };
+            QueueScalingPoint point;
+            point.queueCount = n;
+            point.aggregate = mean(aggregate);
+            std::string detail;
+            for (uint32_t i = 0; i < n; ++i) {
+                point.perQueue.push_back(mean(perQueue[i]));
+                char part[48];
+                snprintf(part, sizeof(part), "%s%s %.2f", i ? ", " : "", scaling.queueLabels[i].c_str(), point.perQueue[i]);
+                detail += part;
+            }
+            points.push_back(point);
+
+            char line[96];
+            snprintf(line, sizeof(line), "  %s x%u: %.2f GB/s aggregate", label, n, point.aggregate);
+            Log(std::string(line) + " (" + detail + ")");
+        }
+
+        uint32_t saturating = SaturatingQueueCount(points);
+        if (saturating > 0) {
+            Log(std::string("[INFO] ") + label + " saturates at " + std::to_string(saturating) + " queue(s)");
+        }
+    };
+
+    if (ok) {
+        runDirection("CPU->GPU", cpuUpload.buffer, gpuBuffer.buffer, scaling.upload);
+        runDirection("GPU->CPU", gpuBuffer.buffer, cpuReadback.buffer, scaling.download);
+    }
+
+    // A failed or cancelled wait can leave copies in flight on any queue
+    vkDeviceWaitIdle(Bench().device);
+    for (VkFence fence : fences) {
+        if (fence != VK_NULL_HANDLE) vkDestroyFence(Bench().device, fence, nullptr);
+    }
+    for (VkCommandPool pool : pools) {
+        if (pool != VK_NULL_HANDLE) vkDestroyCommandPool(Bench().device, pool, nullptr);
+    }
+    if (queryPool != VK_NULL_HANDLE) vkDestroyQueryPool(Bench().device, queryPool, nullptr);
+    cpuUpload.Destroy(Bench().device);
+    gpuBuffer.Destroy(Bench().device);
+    cpuReadback.Destroy(Bench().device);
+
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.queueScaling = std::move(scaling);
+}
+
 // Helper to aggregate results with the same base test name
 std::vector<BenchmarkResult> AggregateResults(const std::vector<BenchmarkResult>& rawResults) {
     // Map from base test name to aggregated samples
     std::map<std::string, std::vector<double>> aggregatedSamples;
     std::map<std::string, std::string> unitMap;
+    std::map<std::string, LatencyHistogram> histogramMap;  // Merged counts, not averaged percentiles
+    std::map<std::string, bool> hasCIMap;
+    std::map<std::string, int> rejectedMap;
+    std::map<std::string, HostTimeline> timelineMap;  // Sample-weighted sums
     
     for (const auto& r : rawResults) {
         // Extract base name (remove " Run X" suffix if present)
@@ -3586,6 +5722,15 @@ std::vector<BenchmarkResult> AggregateResults(const std::vector<BenchmarkResult>
             aggregatedSamples[baseName].push_back(s);
         }
         unitMap[baseName] = r.unit;
+        histogramMap[baseName].Merge(r.histogram);
+        hasCIMap[baseName] = hasCIMap[baseName] || r.ciHigh > 0;
+        rejectedMap[baseName] += r.rejectedSamples;
+        HostTimeline& timeline = timelineMap[baseName];
+        timeline.submitToStartUs += r.timeline.submitToStartUs * r.timeline.samples;
+        timeline.transferUs += r.timeline.transferUs * r.timeline.samples;
+        timeline.wakeupUs += r.timeline.wakeupUs * r.timeline.samples;
+        timeline.samples += r.timeline.samples;
+        timeline.rejected += r.timeline.rejected;
     }
     
     // Build aggregated results
@@ -3602,6 +5747,15 @@ std::vector<BenchmarkResult> AggregateResults(const std::vector<BenchmarkResult>
         r.maxValue = samples.back();
         r.avgValue = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
         r.samples = std::move(samples);
+        r.histogram = std::move(histogramMap[name]);
+        if (hasCIMap[name]) BootstrapMeanCI(r.samples, r.ciLow, r.ciHigh);
+        r.rejectedSamples = rejectedMap[name];
+        r.timeline = timelineMap[name];
+        if (r.timeline.samples > 0) {
+            r.timeline.submitToStartUs /= r.timeline.samples;
+            r.timeline.transferUs /= r.timeline.samples;
+            r.timeline.wakeupUs /= r.timeline.samples;
+        }
         
         aggregated.push_back(r);
     }
@@ -3631,8 +5785,21 @@ std::string GetPatternName(VRAMTestPattern pattern) {
     }
 }
 
-// Generate test pattern data
-void GenerateTestPattern(VRAMTestPattern pattern, uint32_t* data, size_t count, int iteration = 0) {
+// Counter-based Random pattern: lowbias32 hash of (index ^ seed). Any dword's
+// value can be computed on its own, and it matches g_vramPatternSPIRV exactly.
+inline uint32_t RandomPatternValue(uint32_t seed, uint32_t index) {
+    uint32_t x = index ^ seed;
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Generate test pattern data for dwords [startIndex, startIndex + count) of a chunk
+void GenerateTestPattern(VRAMTestPattern pattern, uint32_t* data, size_t count, int iteration = 0,
+                         size_t startIndex = 0) {
     switch (pattern) {
         case VRAMTestPattern::AllZeros:
             std::fill(data, data + count, 0x00000000);
@@ -3651,15 +5818,13 @@ void GenerateTestPattern(VRAMTestPattern pattern, uint32_t* data, size_t count,
             break;
             
         case VRAMTestPattern::Random: {
-            // Use a fixed seed for reproducibility - the pattern just needs to be
+            // Fixed seed for reproducibility - the pattern just needs to be
             // pseudo-random, not cryptographically random. Using iteration allows
-            // multiple passes to use different patterns.
-            // IMPORTANT: Must be exactly reproducible between write and verify!
-            const uint32_t RANDOM_BASE_SEED = 0xDEADBEEF;
-            std::mt19937 rng(RANDOM_BASE_SEED + static_cast<uint32_t>(iteration));
-            std::uniform_int_distribution<uint32_t> dist;
+            // multiple passes to use different patterns. Hashing the chunk dword
+            // index keeps write and verify identical for any slice or range.
+            uint32_t seed = Constants::VRAM_RANDOM_SEED + static_cast<uint32_t>(iteration);
             for (size_t i = 0; i < count; ++i) {
-                data[i] = dist(rng);
+                data[i] = RandomPatternValue(seed, static_cast<uint32_t>(startIndex + i));
             }
             break;
         }
@@ -3681,22 +5846,121 @@ void GenerateTestPattern(VRAMTestPattern pattern, uint32_t* data, size_t count,
         case VRAMTestPattern::AddressPattern:
             // Each dword contains its offset - helps locate physical errors
             for (size_t i = 0; i < count; ++i) {
-                data[i] = static_cast<uint32_t>(i);
+                data[i] = static_cast<uint32_t>(startIndex + i);
             }
             break;
     }
 }
 
+// ----------------------------------------------------------------------------
+// Dirty-block search
+// ----------------------------------------------------------------------------
+// Almost every compare is clean, so CompareBuffers() first proves 64-byte
+// blocks equal with XOR/OR over whole vectors and only runs the per-dword
+// clustering on blocks that differ. Each finder returns the index of the
+// first block in [first, blockCount) containing a mismatch, or blockCount.
+
+constexpr size_t VRAM_COMPARE_BLOCK_DWORDS = 64 / sizeof(uint32_t);
+
+using FindDirtyBlockFn = size_t (*)(const uint32_t* expected, const uint32_t* actual,
+                                    size_t first, size_t blockCount);
+
+size_t FindDirtyBlockScalar(const uint32_t* expected, const uint32_t* actual,
+                            size_t first, size_t blockCount) {
+    for (size_t block = first; block < blockCount; ++block) {
+        const uint32_t* e = expected + block * VRAM_COMPARE_BLOCK_DWORDS;
+        const uint32_t* a = actual + block * VRAM_COMPARE_BLOCK_DWORDS;
+        uint32_t diff = 0;
+        for (size_t i = 0; i < VRAM_COMPARE_BLOCK_DWORDS; ++i) diff |= e[i] ^ a[i];
+        if (diff != 0) return block;
+    }
+    return blockCount;
+}
+
+#ifdef VRAM_COMPARE_X86
+size_t FindDirtyBlockSSE2(const uint32_t* expected, const uint32_t* actual,
+                          size_t first, size_t blockCount) {
+    const __m128i zero = _mm_setzero_si128();
+    for (size_t block = first; block < blockCount; ++block) {
+        const __m128i* e = reinterpret_cast<const __m128i*>(expected + block * VRAM_COMPARE_BLOCK_DWORDS);
+        const __m128i* a = reinterpret_cast<const __m128i*>(actual + block * VRAM_COMPARE_BLOCK_DWORDS);
+        __m128i diff = _mm_or_si128(
+            _mm_or_si128(_mm_xor_si128(_mm_loadu_si128(e + 0), _mm_loadu_si128(a + 0)),
+                         _mm_xor_si128(_mm_loadu_si128(e + 1), _mm_loadu_si128(a + 1))),
+            _mm_or_si128(_mm_xor_si128(_mm_loadu_si128(e + 2), _mm_loadu_si128(a + 2)),
+                         _mm_xor_si128(_mm_loadu_si128(e + 3), _mm_loadu_si128(a + 3))));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(diff, zero)) != 0xFFFF) return block;
+    }
+    return blockCount;
+}
+
+__attribute__((target("avx2")))
+size_t FindDirtyBlockAVX2(const uint32_t* expected, const uint32_t* actual,
+                          size_t first, size_t blockCount) {
+    for (size_t block = first; block < blockCount; ++block) {
+        const __m256i* e = reinterpret_cast<const __m256i*>(expected + block * VRAM_COMPARE_BLOCK_DWORDS);
+        const __m256i* a = reinterpret_cast<const __m256i*>(actual + block * VRAM_COMPARE_BLOCK_DWORDS);
+        __m256i diff = _mm256_or_si256(
+            _mm256_xor_si256(_mm256_loadu_si256(e + 0), _mm256_loadu_si256(a + 0)),
+            _mm256_xor_si256(_mm256_loadu_si256(e + 1), _mm256_loadu_si256(a + 1)));
+        if (!_mm256_testz_si256(diff, diff)) return block;
+    }
+    return blockCount;
+}
+
+__attribute__((target("avx512f")))
+size_t FindDirtyBlockAVX512(const uint32_t* expected, const uint32_t* actual,
+                            size_t first, size_t blockCount) {
+    for (size_t block = first; block < blockCount; ++block) {
+        __m512i e = _mm512_loadu_si512(expected + block * VRAM_COMPARE_BLOCK_DWORDS);
+        __m512i a = _mm512_loadu_si512(actual + block * VRAM_COMPARE_BLOCK_DWORDS);
+        if (_mm512_cmpneq_epi32_mask(e, a) != 0) return block;
+    }
+    return blockCount;
+}
+#endif
+
+struct DirtyBlockFinder {
+    FindDirtyBlockFn find;
+    const char*      name;
+};
+
+DirtyBlockFinder SelectDirtyBlockFinder() {
+#ifdef VRAM_COMPARE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return { FindDirtyBlockAVX512, "AVX-512" };
+    if (__builtin_cpu_supports("avx2"))    return { FindDirtyBlockAVX2, "AVX2" };
+    return { FindDirtyBlockSSE2, "SSE2" };
+#else
+    return { FindDirtyBlockScalar, "scalar" };
+#endif
+}
+
+const DirtyBlockFinder& GetDirtyBlockFinder() {
+    static const DirtyBlockFinder finder = SelectDirtyBlockFinder();
+    return finder;
+}
+
 // Compare buffers and find errors
 void CompareBuffers(const uint32_t* expected, const uint32_t* actual, size_t count,
                    VRAMTestPattern pattern, std::vector<VRAMError>& errors,
                    size_t baseOffset, size_t& totalErrorCount) {
     
-    const size_t CLUSTER_THRESHOLD = 256u;  // Merge errors within this range
+    const size_t CLUSTER_THRESHOLD = Constants::VRAM_ERROR_CLUSTER_DWORDS;
     VRAMError currentCluster;
     bool inCluster = false;
     
+    // Clean blocks hold no mismatches and can't affect clustering, so only
+    // dirty blocks (and the sub-block tail) go through the per-dword loop
+    const FindDirtyBlockFn findDirtyBlock = GetDirtyBlockFinder().find;
+    const size_t blockCount = count / VRAM_COMPARE_BLOCK_DWORDS;
+    
     for (size_t i = 0; i < count; ++i) {
+        if (i % VRAM_COMPARE_BLOCK_DWORDS == 0 && i / VRAM_COMPARE_BLOCK_DWORDS < blockCount) {
+            // At a block boundary: skip ahead to the next dirty block (or the tail)
+            i = findDirtyBlock(expected, actual, i / VRAM_COMPARE_BLOCK_DWORDS, blockCount) * VRAM_COMPARE_BLOCK_DWORDS;
+            if (i >= count) break;
+        }
         if (expected[i] != actual[i]) {
             totalErrorCount++;
             size_t byteOffset = baseOffset + (i * sizeof(uint32_t));
@@ -3735,6 +5999,169 @@ void CompareBuffers(const uint32_t* expected, const uint32_t* actual, size_t cou
     }
 }
 
+// Appends one range's clusters to the current pass, merging the first cluster
+// into the previous range's last one when they are within the cluster
+// threshold - the same clusters a single CompareBuffers() over the whole chunk
+// would produce. passFirstError is the index of the pass's first cluster.
+void AppendErrorClusters(std::vector<VRAMError>& errors, size_t passFirstError,
+                         const std::vector<VRAMError>& sliceErrors) {
+    for (size_t i = 0; i < sliceErrors.size(); ++i) {
+        const VRAMError& err = sliceErrors[i];
+        if (i == 0 && errors.size() > passFirstError) {
+            VRAMError& last = errors.back();
+            if (err.offsetStart - last.offsetEnd <= Constants::VRAM_ERROR_CLUSTER_DWORDS * sizeof(uint32_t)) {
+                last.offsetEnd = err.offsetEnd;
+                last.errorCount += err.errorCount;
+                continue;
+            }
+        }
+        errors.push_back(err);
+    }
+}
+
+// Checks actual[0, count) against the pattern for chunk dwords
+// [startIndex, startIndex + count) without an expected buffer: expected
+// values are regenerated one L1-sized tile at a time and compared in place,
+// so verification reads only the data under test.
+void VerifyTestPattern(VRAMTestPattern pattern, int iteration, const uint32_t* actual, size_t count,
+                       size_t startIndex, std::vector<VRAMError>& errors, size_t baseOffset,
+                       size_t& totalErrorCount) {
+    constexpr size_t TILE_DWORDS = 1024;  // 4 KB
+    alignas(64) uint32_t tile[TILE_DWORDS];
+    std::vector<VRAMError> tileErrors;
+    const size_t firstError = errors.size();
+
+    for (size_t done = 0; done < count; done += TILE_DWORDS) {
+        size_t tileDwords = std::min(TILE_DWORDS, count - done);
+        GenerateTestPattern(pattern, tile, tileDwords, iteration, startIndex + done);
+        tileErrors.clear();
+        CompareBuffers(tile, actual + done, tileDwords, pattern, tileErrors,
+                       baseOffset + done * sizeof(uint32_t), totalErrorCount);
+        AppendErrorClusters(errors, firstError, tileErrors);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Host worker pool
+// ----------------------------------------------------------------------------
+// Fixed set of threads for host-side pattern generation and verification.
+// ParallelFor() may be called from several threads at once (the scan's
+// generator and verifier stages share one pool); each call blocks until its
+// own tasks have run.
+
+struct WorkerPool {
+    std::vector<std::thread>          threads;
+    std::mutex                        mutex;
+    std::condition_variable           cv;
+    std::deque<std::function<void()>> tasks;
+    bool                              stopping = false;
+};
+
+void StartWorkerPool(WorkerPool& pool, size_t threadCount) {
+    pool.stopping = false;
+    for (size_t i = 0; i < std::max<size_t>(threadCount, 1); ++i) {
+        pool.threads.emplace_back([&pool]() {
+            for (;;) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(pool.mutex);
+                    pool.cv.wait(lock, [&] { return pool.stopping || !pool.tasks.empty(); });
+                    if (pool.tasks.empty()) return;  // Stopping and drained
+                    task = std::move(pool.tasks.front());
+                    pool.tasks.pop_front();
+                }
+                task();
+            }
+        });
+    }
+}
+
+void StopWorkerPool(WorkerPool& pool) {
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.stopping = true;
+    }
+    pool.cv.notify_all();
+    for (auto& t : pool.threads) t.join();
+    pool.threads.clear();
+}
+
+// Runs fn(0) .. fn(taskCount - 1) on the pool and waits for all of them
+void ParallelFor(WorkerPool& pool, size_t taskCount, const std::function<void(size_t)>& fn) {
+    if (taskCount == 0) return;
+    if (taskCount == 1 || pool.threads.empty()) {
+        for (size_t i = 0; i < taskCount; ++i) fn(i);
+        return;
+    }
+
+    std::mutex doneMutex;
+    std::condition_variable doneCv;
+    size_t remaining = taskCount;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        for (size_t i = 0; i < taskCount; ++i) {
+            pool.tasks.emplace_back([&, i]() {
+                fn(i);
+                std::lock_guard<std::mutex> doneLock(doneMutex);
+                if (--remaining == 0) doneCv.notify_all();
+            });
+        }
+    }
+    pool.cv.notify_all();
+
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCv.wait(lock, [&] { return remaining == 0; });
+}
+
+// Splits [0, count) dwords into at most `parts` (first, length) ranges with
+// boundaries on 64-byte cache lines and at least minDwords each
+std::vector<std::pair<size_t, size_t>> SplitDwordRange(size_t count, size_t parts, size_t minDwords) {
+    const size_t lineDwords = 64 / sizeof(uint32_t);
+    minDwords = std::max(minDwords, lineDwords);
+    parts = std::max<size_t>(1, std::min(parts, count / minDwords));
+    size_t rangeDwords = (count + parts - 1) / parts;
+    rangeDwords = (rangeDwords + lineDwords - 1) / lineDwords * lineDwords;
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (size_t first = 0; first < count; first += rangeDwords) {
+        ranges.emplace_back(first, std::min(rangeDwords, count - first));
+    }
+    return ranges;
+}
+
+// Parallel GenerateTestPattern(). Every pattern is a function of the chunk
+// dword index, so the split doesn't change the data.
+void GenerateTestPatternParallel(WorkerPool& pool, VRAMTestPattern pattern, uint32_t* data, size_t count,
+                                 int iteration, size_t startIndex) {
+    auto ranges = SplitDwordRange(count, pool.threads.size(), Constants::VRAM_SCAN_MIN_WORKER_DWORDS);
+    ParallelFor(pool, ranges.size(), [&](size_t r) {
+        GenerateTestPattern(pattern, data + ranges[r].first, ranges[r].second, iteration,
+                            startIndex + ranges[r].first);
+    });
+}
+
+// Parallel VerifyTestPattern(). Per-range clusters are merged in address order
+// at the range boundaries, giving the same clusters as a single-threaded pass.
+void VerifyTestPatternParallel(WorkerPool& pool, VRAMTestPattern pattern, int iteration,
+                               const uint32_t* actual, size_t count, size_t startIndex,
+                               std::vector<VRAMError>& errors, size_t baseOffset, size_t& totalErrorCount) {
+    auto ranges = SplitDwordRange(count, pool.threads.size(), Constants::VRAM_SCAN_MIN_WORKER_DWORDS);
+    std::vector<std::vector<VRAMError>> rangeErrors(ranges.size());
+    std::vector<size_t> rangeCounts(ranges.size(), 0);
+
+    ParallelFor(pool, ranges.size(), [&](size_t r) {
+        VerifyTestPattern(pattern, iteration, actual + ranges[r].first, ranges[r].second,
+                          startIndex + ranges[r].first, rangeErrors[r],
+                          baseOffset + ranges[r].first * sizeof(uint32_t), rangeCounts[r]);
+    });
+
+    const size_t firstError = errors.size();
+    for (size_t r = 0; r < ranges.size(); ++r) {
+        AppendErrorClusters(errors, firstError, rangeErrors[r]);
+        totalErrorCount += rangeCounts[r];
+    }
+}
+
 // Format error address as hex string
 std::string FormatErrorAddress(size_t offset) {
     std::ostringstream oss;
@@ -3743,883 +6170,3264 @@ std::string FormatErrorAddress(size_t offset) {
 }
 
 
-bool RunVRAMPatternTest(VRAMTestPattern pattern, size_t regionSize, size_t regionOffset,
-                        VkBufferAllocation& uploadBuffer, VkBufferAllocation& gpuBuffer,
-                        VkBufferAllocation& readbackBuffer, std::vector<VRAMError>& errors,
-                        size_t& totalErrors, int iteration = 0) {
-    
-    if (g_app.vramTestCancelRequested) return false;
-    
-    // Ensure region size is aligned to 4 bytes
-    regionSize = regionSize & ~3ULL;
-    if (regionSize == 0) return true;
-    
-    size_t dwordCount = regionSize / sizeof(uint32_t);
-    
-    // Map upload buffer and write pattern
-    void* mappedData = nullptr;
-    VkResult mapResult = vkMapMemory(g_app.benchDevice, uploadBuffer.memory, 0, regionSize, 0, &mappedData);
-    if (mapResult != VK_SUCCESS) {
-        Log("[ERROR] Failed to map upload buffer for VRAM test");
-        return false;
-    }
-    
-    if (g_app.vramTestCancelRequested) {
-        vkUnmapMemory(g_app.benchDevice, uploadBuffer.memory);
-        return false;
-    }
-    
-    uint32_t* uploadData = static_cast<uint32_t*>(mappedData);
-    GenerateTestPattern(pattern, uploadData, dwordCount, iteration);
-    
-    // Flush (if not host coherent, but our Upload type uses HOST_COHERENT)
-    vkUnmapMemory(g_app.benchDevice, uploadBuffer.memory);
-    
-    // Copy pattern to GPU
-    BeginBenchCommandBuffer();
-    VkBufferCopy copyRegion = {};
-    copyRegion.size = regionSize;
-    vkCmdCopyBuffer(g_app.benchCommandBuffer, uploadBuffer.buffer, gpuBuffer.buffer, 1, &copyRegion);
-    
-    FenceWaitResult result = EndAndSubmitBenchCommandBuffer();
-    if (result != FenceWaitResult::Success) {
-        Log("[ERROR] GPU fence wait failed during VRAM write");
-        return false;
-    }
-    
-    if (g_app.vramTestCancelRequested) return false;
-    
-    // Memory barrier and copy back
-    BeginBenchCommandBuffer();
-    
-    VkMemoryBarrier memBarrier = {};
-    memBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-    memBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-    memBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-    vkCmdPipelineBarrier(g_app.benchCommandBuffer,
-        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-        0, 1, &memBarrier, 0, nullptr, 0, nullptr);
-    
-    vkCmdCopyBuffer(g_app.benchCommandBuffer, gpuBuffer.buffer, readbackBuffer.buffer, 1, &copyRegion);
-    
-    result = EndAndSubmitBenchCommandBuffer();
-    if (result != FenceWaitResult::Success) {
-        Log("[ERROR] GPU fence wait failed during VRAM read");
-        return false;
+// ----------------------------------------------------------------------------
+// Pipelined scan
+// ----------------------------------------------------------------------------
+// A chunk is processed as a stream of slice-sized steps. Step k belongs to
+// pass p = k / S and slice j = k % S (S = slices per chunk). Its command buffer
+// first reads slice j back (still holding pass p-1) and then writes pass p
+// into it, so every slice is read back a whole chunk's worth of writes after
+// it was written - the data comes from VRAM, not from the GPU's L2/last-level
+// cache, exactly as with the old whole-chunk write-then-read.
+//
+// Three stages run concurrently over a ring of staging slots:
+//   generator thread - fills the upload slot for step k+1
+//   calling thread   - records/submits step k and waits on the slot's fence
+//   verifier thread  - compares the readback slot of step k-1
+// A final run of S read-only steps drains the last pass.
+
+struct VRAMScanPass {
+    VRAMTestPattern pattern;
+    int iteration;  // Marching bit index, 0 for the other patterns
+};
+
+struct VRAMScanSlot {
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    VkFence         fence = VK_NULL_HANDLE;
+    VkDeviceSize    stagingOffset = 0;  // Offset of this slot in the upload/readback staging buffers
+};
+
+// Staging resources shared by all chunks of one scan
+struct VRAMScanPipeline {
+    VkBufferAllocation        upload;      // slots * sliceSize, HOST_COHERENT
+    VkBufferAllocation        readback;    // slots * sliceSize, HOST_CACHED
+    uint32_t*                 uploadMapped = nullptr;
+    const uint32_t*           readbackMapped = nullptr;
+    std::vector<VRAMScanSlot> slots;
+    size_t                    sliceSize = 0;
+    WorkerPool                workers;     // Host generate/verify threads
+};
+
+void DestroyVRAMScanPipeline(VRAMScanPipeline& pipe) {
+    StopWorkerPool(pipe.workers);
+
+    for (auto& slot : pipe.slots) {
+        if (slot.fence != VK_NULL_HANDLE) vkDestroyFence(Bench().device, slot.fence, nullptr);
+        if (slot.cmd != VK_NULL_HANDLE) vkFreeCommandBuffers(Bench().device, Bench().commandPool, 1, &slot.cmd);
     }
-    
-    // Map readback buffer and compare
-    void* readbackData = nullptr;
-    mapResult = vkMapMemory(g_app.benchDevice, readbackBuffer.memory, 0, regionSize, 0, &readbackData);
-    if (mapResult != VK_SUCCESS) {
-        Log("[ERROR] Failed to map readback buffer for VRAM test");
+    pipe.slots.clear();
+
+    pipe.uploadMapped = nullptr;
+    pipe.readbackMapped = nullptr;
+    pipe.upload.Destroy(Bench().device);
+    pipe.readback.Destroy(Bench().device);
+}
+
+bool CreateVRAMScanPipeline(VRAMScanPipeline& pipe, size_t sliceSize, size_t slotCount) {
+    pipe.sliceSize = sliceSize;
+    pipe.upload = CreateBuffer(VkBufferType::Upload, sliceSize * slotCount);
+    pipe.readback = CreateBuffer(VkBufferType::Readback, sliceSize * slotCount);
+    if (!pipe.upload || !pipe.readback) {
+        Log("[ERROR] Failed to allocate VRAM scan staging buffers");
         return false;
     }
-    
-    // Invalidate memory range for readback (if HOST_CACHED but not HOST_COHERENT)
-    VkMappedMemoryRange memRange = {};
-    memRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-    memRange.memory = readbackBuffer.memory;
-    memRange.offset = 0;
-    memRange.size = VK_WHOLE_SIZE;
-    vkInvalidateMappedMemoryRanges(g_app.benchDevice, 1, &memRange);
-    
-    // Regenerate expected pattern for comparison
-    std::vector<uint32_t> expectedData(dwordCount);
-    GenerateTestPattern(pattern, expectedData.data(), dwordCount, iteration);
-    
-    // Compare
-    const uint32_t* actualData = static_cast<const uint32_t*>(readbackData);
-    CompareBuffers(expectedData.data(), actualData, dwordCount, pattern, errors, regionOffset, totalErrors);
-    
-    vkUnmapMemory(g_app.benchDevice, readbackBuffer.memory);
-    
-    return true;
-}
 
-// Main VRAM test thread function
-void VRAMTestThreadFunc() {
-    auto startTime = std::chrono::steady_clock::now();
-    
-    Log("=== VRAM Scan Started ===");
-    Log("GPU: " + g_app.gpuList[g_app.config.selectedGPU].name);
-    Log("");
-    Log("DISCLAIMER: This is a basic VRAM integrity test using Vulkan.");
-    Log("It can detect obvious errors but is NOT a replacement for");
-    Log("vendor-specific tools like NVIDIA MATS or AMD memory diagnostics.");
-    Log("For chip-level diagnosis, use manufacturer tools.");
-    Log("");
-    
-    g_app.vramTestResult = {};
-    g_app.vramTestProgress = 0.0f;
-    
-    g_app.fenceTimeoutCount = 0;
-    g_app.benchmarkAborted = false;
-    
-    CleanupBenchmarkDevice();
-    if (!InitBenchmarkDevice(g_app.config.selectedGPU)) {
-        Log("[ERROR] Failed to initialize benchmark device for VRAM test");
-        g_app.vramTestResult.completed = false;
-        g_app.vramTestRunning = false;
-        return;
-    }
-    
-    const GPUInfo& gpu = g_app.gpuList[g_app.config.selectedGPU];
-    
-    double targetPercent = g_app.vramTestFullScan ? 0.90 : Constants::VRAM_SAFETY_MARGIN;
-    size_t targetTestSize = static_cast<size_t>(gpu.dedicatedVRAM * targetPercent);
-    
-    if (g_app.vramTestFullScan) {
-        Log("FULL SCAN MODE: Attempting to test up to " + FormatSize(targetTestSize) + " (~90%) of VRAM");
-        Log("[WARNING] Full scan allocates maximum possible VRAM - may cause instability");
-    } else {
-        Log("Testing up to " + FormatSize(targetTestSize) + " (~80%) of VRAM");
-        Log("(Enable 'Full Scan' for more thorough testing)");
+    pipe.uploadMapped = static_cast<uint32_t*>(pipe.upload.mappedPtr);
+    pipe.readbackMapped = static_cast<const uint32_t*>(pipe.readback.mappedPtr);
+
+    pipe.slots.resize(slotCount);
+    VkCommandBufferAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = Bench().commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    VkFenceCreateInfo fenceInfo = {};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    for (size_t i = 0; i < slotCount; ++i) {
+        VRAMScanSlot& slot = pipe.slots[i];
+        slot.stagingOffset = static_cast<VkDeviceSize>(i * sliceSize);
+        VK_CHECK_RETURN(vkAllocateCommandBuffers(Bench().device, &allocInfo, &slot.cmd), false);
+        VK_CHECK_RETURN(vkCreateFence(Bench().device, &fenceInfo, nullptr, &slot.fence), false);
     }
-    Log("");
-    
-    Log("NOTE: GPU drivers and OS reserve some VRAM for:");
-    Log("  - Command buffers and page tables");
-    Log("  - Desktop compositor (Wayland/X11)");
-    Log("  - Vulkan runtime scratch space");
-    Log("We test as much as can be allocated via Vulkan.");
-    Log("");
-    
-    std::vector<VRAMTestPattern> patterns = {
-        VRAMTestPattern::AllZeros,
-        VRAMTestPattern::AllOnes,
-        VRAMTestPattern::Checkerboard,
-        VRAMTestPattern::InverseCheckerboard,
-        VRAMTestPattern::AddressPattern,
-        VRAMTestPattern::Random
+
+    StartWorkerPool(pipe.workers, std::max(1u, std::thread::hardware_concurrency()));
+    return true;
+}
+
+// Runs all passes over one device-local chunk. Returns false on GPU failure
+// or cancellation; errors/chunkErrors hold whatever was verified so far.
+bool RunVRAMChunkPipeline(VRAMScanPipeline& pipe, const std::vector<VRAMScanPass>& passes,
+                          VkBufferAllocation& gpuBuffer, size_t chunkSize, size_t chunkOffset,
+                          const std::string& chunkLabel, std::vector<VRAMError>& errors,
+                          size_t& chunkErrors, float progressBase, float progressSpan) {
+    chunkSize &= ~static_cast<size_t>(3);
+    if (chunkSize == 0 || passes.empty()) return true;
+
+    const size_t depth = pipe.slots.size();
+    const size_t sliceDwords = pipe.sliceSize / sizeof(uint32_t);
+    const size_t sliceCount = (chunkSize + pipe.sliceSize - 1) / pipe.sliceSize;
+    const size_t passCount = passes.size();
+    const size_t totalSteps = (passCount + 1) * sliceCount;
+
+    auto sliceBytes = [&](size_t slice) -> size_t {
+        return std::min(pipe.sliceSize, chunkSize - slice * pipe.sliceSize);
     };
-    
-    const int MARCH_ITERATIONS = 4;
-    
-    const size_t PREFERRED_CHUNK_SIZE = 512ull * 1024 * 1024;
-    const size_t MIN_CHUNK_SIZE = 128ull * 1024 * 1024;
-    
-    size_t chunkSize = PREFERRED_CHUNK_SIZE;
-    
-    Log("Finding optimal chunk size...");
-    
-    {
-        while (chunkSize >= MIN_CHUNK_SIZE) {
-            if (g_app.vramTestCancelRequested) {
-                g_app.vramTestResult.cancelled = true;
-                g_app.vramTestRunning = false;
-                return;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t generated = 0, transferred = 0, verified = 0;
+    bool aborted = false;
+
+    // Blocks until ready() holds (mutex held); false if aborted or cancelled.
+    // Cancellation is not signalled on the condition variable, so poll it.
+    auto waitUntil = [&](std::unique_lock<std::mutex>& lock, const std::function<bool()>& ready) -> bool {
+        while (!ready()) {
+            if (aborted || g_app.vramTestCancelRequested) return false;
+            cv.wait_for(lock, std::chrono::milliseconds(50));
+        }
+        return !aborted && !g_app.vramTestCancelRequested;
+    };
+
+    std::thread generator([&]() {
+        for (size_t step = 0; step < totalSteps; ++step) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (!waitUntil(lock, [&] { return step < verified + depth; })) return;
             }
-            
-            auto testUpload = CreateBuffer(VkBufferType::Upload, chunkSize);
-            auto testGpu = CreateBuffer(VkBufferType::DeviceLocal, chunkSize);
-            auto testReadback = CreateBuffer(VkBufferType::Readback, chunkSize);
-            
-            if (testUpload && testGpu && testReadback) {
-                Log("Using " + FormatSize(chunkSize) + " chunk size");
-                testUpload.Destroy(g_app.benchDevice);
-                testGpu.Destroy(g_app.benchDevice);
-                testReadback.Destroy(g_app.benchDevice);
-                break;
+            size_t pass = step / sliceCount;
+            size_t slice = step % sliceCount;
+            if (pass < passCount) {
+                const VRAMScanSlot& slot = pipe.slots[step % depth];
+                GenerateTestPatternParallel(pipe.workers, passes[pass].pattern,
+                                            pipe.uploadMapped + slot.stagingOffset / sizeof(uint32_t),
+                                            sliceBytes(slice) / sizeof(uint32_t),
+                                            passes[pass].iteration, slice * sliceDwords);
+                FlushMappedBuffer(Bench().device, pipe.upload, slot.stagingOffset, sliceBytes(slice));
             }
-            
-            testUpload.Destroy(g_app.benchDevice);
-            testGpu.Destroy(g_app.benchDevice);
-            testReadback.Destroy(g_app.benchDevice);
-            chunkSize /= 2;
+            std::lock_guard<std::mutex> lock(mutex);
+            generated = step + 1;
+            cv.notify_all();
+        }
+    });
+
+    std::thread verifier([&]() {
+        std::vector<VRAMError> sliceErrors;
+        size_t passFirstError = errors.size();
+        for (size_t step = 0; step < totalSteps; ++step) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (!waitUntil(lock, [&] { return step < transferred; })) return;
+            }
+            size_t pass = step / sliceCount;
+            size_t slice = step % sliceCount;
+            if (pass > 0) {
+                const VRAMScanPass& verifyPass = passes[pass - 1];
+                const VRAMScanSlot& slot = pipe.slots[step % depth];
+                size_t dwords = sliceBytes(slice) / sizeof(uint32_t);
+                if (slice == 0) passFirstError = errors.size();
+
+                sliceErrors.clear();
+                VerifyTestPatternParallel(pipe.workers, verifyPass.pattern, verifyPass.iteration,
+                                          pipe.readbackMapped + slot.stagingOffset / sizeof(uint32_t), dwords,
+                                          slice * sliceDwords, sliceErrors, chunkOffset + slice * pipe.sliceSize,
+                                          chunkErrors);
+                AppendErrorClusters(errors, passFirstError, sliceErrors);
+            }
+            g_app.vramTestProgress = progressBase + progressSpan *
+                (static_cast<float>(step + 1) / static_cast<float>(totalSteps));
+
+            std::lock_guard<std::mutex> lock(mutex);
+            verified = step + 1;
+            cv.notify_all();
         }
-        
-        if (chunkSize < MIN_CHUNK_SIZE) {
-            Log("[ERROR] Failed to allocate test buffers even at " + FormatSize(MIN_CHUNK_SIZE));
-            Log("[ERROR] Try closing other applications to free VRAM");
-            g_app.vramTestResult.completed = false;
-            g_app.vramTestRunning = false;
-            return;
+    });
+
+    // DMA stage on the calling thread - the only thread recording/submitting
+    VkMemoryBarrier memBarrier = {};
+    memBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    memBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    bool ok = true;
+    VkFence pendingFence = VK_NULL_HANDLE;  // Submitted but not successfully waited on
+    size_t currentPass = SIZE_MAX;
+
+    for (size_t step = 0; step < totalSteps; ++step) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!waitUntil(lock, [&] { return step < generated; })) { ok = false; break; }
         }
-    }
-    
-    size_t numChunks = (targetTestSize + chunkSize - 1) / chunkSize;
-    size_t patternsPerChunk = patterns.size() + 2;
-    size_t totalSteps = numChunks * patternsPerChunk;
-    size_t completedSteps = 0;
-    
-    double targetPercentDisplay = (static_cast<double>(targetTestSize) / gpu.dedicatedVRAM) * 100.0;
-    char percentBuf[64];
-    snprintf(percentBuf, sizeof(percentBuf), "%.0f%%", targetPercentDisplay);
-    
-    Log("");
-    Log("Will test " + FormatSize(targetTestSize) + " (" + percentBuf + " of VRAM) in " + 
-        std::to_string(numChunks) + " chunks");
-    Log("Each chunk: 6 basic patterns + marching ones + marching zeros");
-    Log("Reallocating between chunks to potentially hit different physical regions");
-    Log("");
-    
-    size_t totalErrors = 0;
-    std::vector<VRAMError> allErrors;
-    bool hadCriticalFailure = false;
-    size_t totalBytesTested = 0;
-    
-    for (size_t chunkNum = 0; chunkNum < numChunks && !g_app.vramTestCancelRequested && !hadCriticalFailure; ++chunkNum) {
-        size_t chunkOffset = chunkNum * chunkSize;
-        size_t thisChunkSize = std::min(chunkSize, targetTestSize - chunkOffset);
-        
-        Log("=== Chunk " + std::to_string(chunkNum + 1) + "/" + std::to_string(numChunks) + 
-            " (" + FormatSize(thisChunkSize) + " at logical offset " + FormatSize(chunkOffset) + ") ===");
-        
-        auto uploadBuffer = CreateBuffer(VkBufferType::Upload, thisChunkSize);
-        auto gpuBuffer = CreateBuffer(VkBufferType::DeviceLocal, thisChunkSize);
-        auto readbackBuffer = CreateBuffer(VkBufferType::Readback, thisChunkSize);
-        
-        if (!uploadBuffer || !gpuBuffer || !readbackBuffer) {
-            Log("[WARNING] Failed to allocate buffers for chunk " + std::to_string(chunkNum + 1) + " - stopping");
-            uploadBuffer.Destroy(g_app.benchDevice);
-            gpuBuffer.Destroy(g_app.benchDevice);
-            readbackBuffer.Destroy(g_app.benchDevice);
-            break;
+        size_t pass = step / sliceCount;
+        size_t slice = step % sliceCount;
+        if (pass != currentPass && pass < passCount) {
+            currentPass = pass;
+            g_app.vramTestCurrentPattern = GetPatternName(passes[pass].pattern) + " " + chunkLabel;
+            Bench().fenceTimeoutCount = 0;
         }
-        
-        size_t chunkErrors = 0;
-        bool chunkFailed = false;
-        
-        for (const auto& pattern : patterns) {
-            if (g_app.vramTestCancelRequested || chunkFailed) break;
-            
-            std::string patternName = GetPatternName(pattern);
-            g_app.vramTestCurrentPattern = patternName + " [" + std::to_string(chunkNum + 1) + "/" + std::to_string(numChunks) + "]";
-            
-            g_app.fenceTimeoutCount = 0;
-            size_t patternErrors = 0;
-            
-            if (!RunVRAMPatternTest(pattern, thisChunkSize, chunkOffset,
-                                    uploadBuffer, gpuBuffer, readbackBuffer,
-                                    allErrors, patternErrors)) {
-                if (!g_app.vramTestCancelRequested) {
-                    Log("  [WARNING] " + patternName + " failed");
-                    chunkFailed = true;
-                }
-                break;
-            }
-            
-            chunkErrors += patternErrors;
+
+        VRAMScanSlot& slot = pipe.slots[step % depth];
+        VkDeviceSize bytes = sliceBytes(slice);
+        VkDeviceSize gpuOffset = static_cast<VkDeviceSize>(slice) * pipe.sliceSize;
+
+        vkResetCommandBuffer(slot.cmd, 0);
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(slot.cmd, &beginInfo);
+
+        // Order against the previous steps' copies on this queue
+        vkCmdPipelineBarrier(slot.cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0, 1, &memBarrier, 0, nullptr, 0, nullptr);
+
+        if (pass > 0) {
+            VkBufferCopy readRegion = { gpuOffset, slot.stagingOffset, bytes };
+            vkCmdCopyBuffer(slot.cmd, gpuBuffer.buffer, pipe.readback.buffer, 1, &readRegion);
+            vkCmdPipelineBarrier(slot.cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                0, 1, &memBarrier, 0, nullptr, 0, nullptr);
         }
-        
-        // Run marching patterns
-        if (!g_app.vramTestCancelRequested && !chunkFailed) {
-            g_app.vramTestCurrentPattern = "Marching [" + std::to_string(chunkNum + 1) + "/" + std::to_string(numChunks) + "]";
-            g_app.fenceTimeoutCount = 0;
-            
-            for (int iter = 0; iter < MARCH_ITERATIONS && !g_app.vramTestCancelRequested && !chunkFailed; ++iter) {
-                size_t marchErrors = 0;
-                if (!RunVRAMPatternTest(VRAMTestPattern::MarchingOnes, thisChunkSize, chunkOffset,
-                                  uploadBuffer, gpuBuffer, readbackBuffer,
-                                  allErrors, marchErrors, iter)) {
-                    chunkFailed = true;
-                    break;
-                }
-                chunkErrors += marchErrors;
-            }
-            
-            for (int iter = 0; iter < MARCH_ITERATIONS && !g_app.vramTestCancelRequested && !chunkFailed; ++iter) {
-                size_t marchErrors = 0;
-                if (!RunVRAMPatternTest(VRAMTestPattern::MarchingZeros, thisChunkSize, chunkOffset,
-                                  uploadBuffer, gpuBuffer, readbackBuffer,
-                                  allErrors, marchErrors, iter)) {
-                    chunkFailed = true;
-                    break;
-                }
-                chunkErrors += marchErrors;
-            }
+        if (pass < passCount) {
+            VkBufferCopy writeRegion = { slot.stagingOffset, gpuOffset, bytes };
+            vkCmdCopyBuffer(slot.cmd, pipe.upload.buffer, gpuBuffer.buffer, 1, &writeRegion);
         }
-        
-        uploadBuffer.Destroy(g_app.benchDevice);
-        gpuBuffer.Destroy(g_app.benchDevice);
-        readbackBuffer.Destroy(g_app.benchDevice);
-        
-        if (!chunkFailed) {
-            totalBytesTested += thisChunkSize;
+        vkEndCommandBuffer(slot.cmd);
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &slot.cmd;
+        VkResult submitResult = vkQueueSubmit(Bench().queue, 1, &submitInfo, slot.fence);
+        if (submitResult != VK_SUCCESS) {
+            Log("[ERROR] vkQueueSubmit failed: " + std::to_string((int)submitResult));
+            ok = false;
+            break;
         }
-        totalErrors += chunkErrors;
-        
-        std::string chunkResult = chunkFailed ? "INCOMPLETE" : 
-                                  (chunkErrors == 0) ? "PASS" : "FAIL (" + std::to_string(chunkErrors) + " errors)";
-        Log("  Chunk " + std::to_string(chunkNum + 1) + " result: " + chunkResult);
-        
-        if (chunkFailed && !g_app.vramTestCancelRequested) {
-            hadCriticalFailure = true;
+        pendingFence = slot.fence;
+
+        FenceWaitResult waitResult = WaitForFenceEx(slot.fence);
+        if (waitResult != FenceWaitResult::Success) {
+            if (waitResult != FenceWaitResult::Cancelled) {
+                Log("  [WARNING] " + GetPatternName(passes[std::min(pass, passCount - 1)].pattern) +
+                    " failed (GPU fence wait during VRAM " + (pass < passCount ? "write" : "read") + ")");
+            }
+            ok = false;
+            break;
         }
-        
-        completedSteps += patternsPerChunk;
-        g_app.vramTestProgress = static_cast<float>(completedSteps) / static_cast<float>(totalSteps);
-        
-        if (chunkNum < numChunks - 1 && !g_app.vramTestCancelRequested) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        pendingFence = VK_NULL_HANDLE;
+
+        if (pass > 0) {
+            InvalidateMappedBuffer(Bench().device, pipe.readback, slot.stagingOffset, pipe.sliceSize);
         }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        transferred = step + 1;
+        cv.notify_all();
     }
-    
-    double coveragePercent = (static_cast<double>(totalBytesTested) / gpu.dedicatedVRAM) * 100.0;
-    snprintf(percentBuf, sizeof(percentBuf), "%.1f%%", coveragePercent);
-    g_app.vramTestResult.patternResults.push_back(
-        std::to_string(totalBytesTested / (1024*1024)) + " MB tested (" + percentBuf + " coverage)");
-    
-    auto endTime = std::chrono::steady_clock::now();
-    double duration = std::chrono::duration<double>(endTime - startTime).count();
-    
-    g_app.vramTestResult.completed = !g_app.vramTestCancelRequested;
-    g_app.vramTestResult.cancelled = g_app.vramTestCancelRequested;
-    g_app.vramTestResult.totalBytesTested = totalBytesTested;
-    g_app.vramTestResult.totalErrors = totalErrors;
-    g_app.vramTestResult.errors = std::move(allErrors);
-    g_app.vramTestResult.testDurationSeconds = duration;
-    
-    Log("");
-    Log("=== VRAM Scan " + std::string(g_app.vramTestCancelRequested ? "Cancelled" : "Complete") + " ===");
-    snprintf(percentBuf, sizeof(percentBuf), "%.1f%%", coveragePercent);
-    Log("Tested: " + FormatSize(totalBytesTested) + " (" + percentBuf + " of " + FormatSize(gpu.dedicatedVRAM) + ")");
-    
-    char durationBuf[64];
-    snprintf(durationBuf, sizeof(durationBuf), "Duration: %.1f seconds", duration);
-    Log(durationBuf);
-    
-    if (totalErrors == 0) {
-        Log("Result: PASS - No errors detected");
-        g_app.vramTestResult.summary = "PASS - No errors in " + FormatSize(totalBytesTested) + " (" + percentBuf + " coverage)";
-    } else {
-        Log("Result: FAIL - " + std::to_string(totalErrors) + " total errors detected!");
-        g_app.vramTestResult.summary = "FAIL - " + std::to_string(totalErrors) + " errors in " + FormatSize(totalBytesTested);
-        
-        Log("");
-        Log("Error Regions:");
-        for (const auto& err : g_app.vramTestResult.errors) {
-            if (err.errorCount > 0) {
-                Log("  " + FormatErrorAddress(err.offsetStart) + " - " + 
-                    FormatErrorAddress(err.offsetEnd) + " (" + 
-                    std::to_string(err.errorCount) + " errors, pattern: " + 
-                    GetPatternName(err.pattern) + ")");
-            }
+
+    if (!ok) {
+        std::lock_guard<std::mutex> lock(mutex);
+        aborted = true;
+        cv.notify_all();
+    }
+    generator.join();
+    verifier.join();
+
+    // Don't hand slot buffers back while the GPU may still be copying into them
+    if (pendingFence != VK_NULL_HANDLE) {
+        uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL;
+        if (vkWaitForFences(Bench().device, 1, &pendingFence, VK_TRUE, timeout) == VK_SUCCESS) {
+            vkResetFences(Bench().device, 1, &pendingFence);
         }
-        
-        Log("");
-        Log("NOTE: Error addresses are logical offsets in the test buffer,");
-        Log("not physical VRAM addresses. For chip-level diagnosis, use");
-        Log("vendor tools like NVIDIA MATS or AMD memory diagnostics.");
     }
-    
-    Log("");
-    
-    CleanupBenchmarkDevice();
-    
-    g_app.vramTestRunning = false;
-    g_app.vramTestProgress = 1.0f;
-    g_app.showVRAMTestWindow = true;
+
+    return ok && !g_app.vramTestCancelRequested;
+}
+
+// ----------------------------------------------------------------------------
+// GPU-side scan
+// ----------------------------------------------------------------------------
+// Patterns are written and verified in place by compute kernels
+// (g_vramPatternSPIRV), so only the mismatch records cross PCIe instead of
+// every byte in both directions. Each pass writes the whole chunk before
+// verifying it, so for any chunk larger than the GPU's caches the verify
+// reads come from VRAM.
+//
+// The bench device only has a transfer queue, so - as with the memory latency
+// test - the kernels run on a separate compute VkDevice and the chunks are
+// allocated there.
+
+enum class VRAMKernelKind : uint32_t { Constant = 0, Address = 1, Random = 2 };
+
+// Push constants of g_vramPatternSPIRV
+struct VRAMKernelParams {
+    uint32_t kind = 0;        // VRAMKernelKind
+    uint32_t value = 0;       // Constant value, or seed for Random
+    uint32_t baseIndex = 0;   // Chunk dword index of the bound window's first dword
+    uint32_t count = 0;       // Dwords in the bound window
+    uint32_t maxErrors = 0;   // Record capacity of the error buffer
+};
+
+// One mismatch as written by the verify kernel
+struct VRAMErrorRecord {
+    uint32_t index;     // Chunk dword index
+    uint32_t expected;
+    uint32_t actual;
+};
+
+struct VRAMComputeScanner {
+    VkDevice              device = VK_NULL_HANDLE;
+    VkQueue               queue = VK_NULL_HANDLE;
+    uint32_t              queueFamily = UINT32_MAX;
+    VkCommandPool         commandPool = VK_NULL_HANDLE;
+    VkCommandBuffer       cmd = VK_NULL_HANDLE;
+    VkFence               fence = VK_NULL_HANDLE;
+    VkShaderModule        shaderModule = VK_NULL_HANDLE;
+    VkDescriptorSetLayout descSetLayout = VK_NULL_HANDLE;
+    VkPipelineLayout      pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline            writePipeline = VK_NULL_HANDLE;
+    VkPipeline            verifyPipeline = VK_NULL_HANDLE;
+    VkDescriptorPool      descPool = VK_NULL_HANDLE;
+    VkBufferAllocation    errorBuffer;               // DEVICE_LOCAL: counter + records
+    VkBufferAllocation    errorReadback;             // HOST_VISIBLE copy, read once per pass
+    const uint32_t*       errorMapped = nullptr;
+    size_t                windowSize = 0;            // Bytes bound per descriptor set
+    uint32_t              maxGroups = 0;             // Workgroups per dispatch (kernel loops over the rest)
+};
+
+void DestroyVRAMComputeScanner(VRAMComputeScanner& sc) {
+    if (sc.device == VK_NULL_HANDLE) return;
+    vkDeviceWaitIdle(sc.device);
+
+    sc.errorReadback.Destroy(sc.device);
+    sc.errorBuffer.Destroy(sc.device);
+
+    if (sc.descPool != VK_NULL_HANDLE) vkDestroyDescriptorPool(sc.device, sc.descPool, nullptr);
+    if (sc.writePipeline != VK_NULL_HANDLE) vkDestroyPipeline(sc.device, sc.writePipeline, nullptr);
+    if (sc.verifyPipeline != VK_NULL_HANDLE) vkDestroyPipeline(sc.device, sc.verifyPipeline, nullptr);
+    if (sc.pipelineLayout != VK_NULL_HANDLE) vkDestroyPipelineLayout(sc.device, sc.pipelineLayout, nullptr);
+    if (sc.descSetLayout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(sc.device, sc.descSetLayout, nullptr);
+    if (sc.shaderModule != VK_NULL_HANDLE) vkDestroyShaderModule(sc.device, sc.shaderModule, nullptr);
+    if (sc.fence != VK_NULL_HANDLE) vkDestroyFence(sc.device, sc.fence, nullptr);
+    if (sc.commandPool != VK_NULL_HANDLE) vkDestroyCommandPool(sc.device, sc.commandPool, nullptr);
+    vkDestroyDevice(sc.device, nullptr);
+
+    sc = VRAMComputeScanner();
+}
+
+// Buffer on a separate compute device of the bench GPU (VRAM scanner, compute
+// copies). Returns an invalid allocation if no memory type has memFlags or the
+// allocation fails.
+VkBufferAllocation CreateComputeDeviceBuffer(VkDevice device, VkDeviceSize size,
+                                             VkBufferUsageFlags usage, VkMemoryPropertyFlags memFlags) {
+    VkBufferAllocation alloc = {};
+    alloc.size = size;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    VkResult result = vkCreateBuffer(device, &bufferInfo, nullptr, &alloc.buffer);
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] vkCreateBuffer failed: " + std::to_string((int)result) +
+            " (Size: " + FormatSize(size) + ")");
+        alloc.buffer = VK_NULL_HANDLE;
+        return alloc;
+    }
+
+    VkMemoryRequirements memReqs;
+    vkGetBufferMemoryRequirements(device, alloc.buffer, &memReqs);
+
+    uint32_t memTypeIndex = FindMemoryType(Bench().physicalDevice, memReqs.memoryTypeBits, memFlags);
+    if (memTypeIndex == UINT32_MAX) {
+        vkDestroyBuffer(device, alloc.buffer, nullptr);
+        alloc.buffer = VK_NULL_HANDLE;
+        return alloc;
+    }
+
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = memReqs.size;
+    allocInfo.memoryTypeIndex = memTypeIndex;
+
+    result = vkAllocateMemory(device, &allocInfo, nullptr, &alloc.memory);
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] vkAllocateMemory failed: " + std::to_string((int)result) +
+            " (Size: " + FormatSize(size) + ")");
+        vkDestroyBuffer(device, alloc.buffer, nullptr);
+        alloc.buffer = VK_NULL_HANDLE;
+        return alloc;
+    }
+
+    vkBindBufferMemory(device, alloc.buffer, alloc.memory, 0);
+    if ((memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && !MapBufferAllocation(device, alloc, memTypeIndex)) {
+        alloc.Destroy(device);
+    }
+    return alloc;
+}
+
+// Creates the compute device, both pattern pipelines and the error buffers.
+// maxChunkSize sizes the descriptor pool. On failure the caller destroys sc.
+bool CreateVRAMComputeScanner(VRAMComputeScanner& sc, size_t maxChunkSize) {
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+    // Prefer an async compute family, otherwise any compute family
+    for (uint32_t i = 0; i < queueFamilyCount; i++) {
+        bool hasCompute = (queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0;
+        bool hasGraphics = (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0;
+        if (hasCompute && !hasGraphics) {
+            sc.queueFamily = i;
+            break;
+        }
+        if (hasCompute && sc.queueFamily == UINT32_MAX) {
+            sc.queueFamily = i;
+        }
+    }
+    if (sc.queueFamily == UINT32_MAX) {
+        Log("[INFO] No compute-capable queue family for GPU-side VRAM verification");
+        return false;
+    }
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo queueInfo = {};
+    queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueInfo.queueFamilyIndex = sc.queueFamily;
+    queueInfo.queueCount = 1;
+    queueInfo.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo deviceInfo = {};
+    deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceInfo.queueCreateInfoCount = 1;
+    deviceInfo.pQueueCreateInfos = &queueInfo;
+    VK_CHECK_RETURN(vkCreateDevice(Bench().physicalDevice, &deviceInfo, nullptr, &sc.device), false);
+    vkGetDeviceQueue(sc.device, sc.queueFamily, 0, &sc.queue);
+
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = sc.queueFamily;
+    VK_CHECK_RETURN(vkCreateCommandPool(sc.device, &poolInfo, nullptr, &sc.commandPool), false);
+
+    VkCommandBufferAllocateInfo cmdAllocInfo = {};
+    cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmdAllocInfo.commandPool = sc.commandPool;
+    cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmdAllocInfo.commandBufferCount = 1;
+    VK_CHECK_RETURN(vkAllocateCommandBuffers(sc.device, &cmdAllocInfo, &sc.cmd), false);
+
+    VkFenceCreateInfo fenceInfo = {};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    VK_CHECK_RETURN(vkCreateFence(sc.device, &fenceInfo, nullptr, &sc.fence), false);
+
+    VkShaderModuleCreateInfo shaderInfo = {};
+    shaderInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    shaderInfo.codeSize = g_vramPatternSPIRVSize;
+    shaderInfo.pCode = g_vramPatternSPIRV;
+    VK_CHECK_RETURN(vkCreateShaderModule(sc.device, &shaderInfo, nullptr, &sc.shaderModule), false);
+
+    // binding 0: window of the chunk under test, binding 1: error counter + records
+    VkDescriptorSetLayoutBinding bindings[2] = {};
+    for (uint32_t i = 0; i < 2; ++i) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 2;
+    layoutInfo.pBindings = bindings;
+    VK_CHECK_RETURN(vkCreateDescriptorSetLayout(sc.device, &layoutInfo, nullptr, &sc.descSetLayout), false);
+
+    VkPushConstantRange pushRange = {};
+    pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushRange.offset = 0;
+    pushRange.size = sizeof(VRAMKernelParams);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &sc.descSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+    VK_CHECK_RETURN(vkCreatePipelineLayout(sc.device, &pipelineLayoutInfo, nullptr, &sc.pipelineLayout), false);
+
+    // Write and verify pipelines differ only in the VERIFY specialization constant
+    VkBool32 verifyFlags[2] = { VK_FALSE, VK_TRUE };
+    VkSpecializationMapEntry specEntry = { 0, 0, sizeof(VkBool32) };
+    VkSpecializationInfo specInfos[2] = {};
+    VkComputePipelineCreateInfo pipelineInfos[2] = {};
+    for (int i = 0; i < 2; ++i) {
+        specInfos[i].mapEntryCount = 1;
+        specInfos[i].pMapEntries = &specEntry;
+        specInfos[i].dataSize = sizeof(VkBool32);
+        specInfos[i].pData = &verifyFlags[i];
+
+        pipelineInfos[i].sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfos[i].stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfos[i].stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfos[i].stage.module = sc.shaderModule;
+        pipelineInfos[i].stage.pName = "main";
+        pipelineInfos[i].stage.pSpecializationInfo = &specInfos[i];
+        pipelineInfos[i].layout = sc.pipelineLayout;
+    }
+    VkPipeline pipelines[2] = { VK_NULL_HANDLE, VK_NULL_HANDLE };
+    VkResult result = vkCreateComputePipelines(sc.device, VK_NULL_HANDLE, 2, pipelineInfos, nullptr, pipelines);
+    sc.writePipeline = pipelines[0];
+    sc.verifyPipeline = pipelines[1];
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] Failed to create VRAM pattern pipelines: " + std::to_string((int)result));
+        return false;
+    }
+
+    // Bind at most maxStorageBufferRange per descriptor (spec minimum 128 MB)
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(Bench().physicalDevice, &props);
+    const size_t windowAlign = 1024 * 1024;
+    sc.windowSize = std::min(Constants::VRAM_SCAN_GPU_WINDOW_SIZE,
+                             static_cast<size_t>(props.limits.maxStorageBufferRange)) & ~(windowAlign - 1);
+    if (sc.windowSize == 0) sc.windowSize = windowAlign;
+    sc.maxGroups = std::min<uint32_t>(props.limits.maxComputeWorkGroupCount[0], 65535u);
+
+    uint32_t maxSets = static_cast<uint32_t>((maxChunkSize + sc.windowSize - 1) / sc.windowSize);
+    VkDescriptorPoolSize descPoolSize = {};
+    descPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descPoolSize.descriptorCount = 2 * maxSets;
+
+    VkDescriptorPoolCreateInfo descPoolInfo = {};
+    descPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descPoolInfo.maxSets = maxSets;
+    descPoolInfo.poolSizeCount = 1;
+    descPoolInfo.pPoolSizes = &descPoolSize;
+    VK_CHECK_RETURN(vkCreateDescriptorPool(sc.device, &descPoolInfo, nullptr, &sc.descPool), false);
+
+    VkDeviceSize errorBytes = sizeof(uint32_t) +
+        static_cast<VkDeviceSize>(Constants::VRAM_SCAN_GPU_MAX_ERRORS) * sizeof(VRAMErrorRecord);
+    sc.errorBuffer = CreateComputeDeviceBuffer(sc.device, errorBytes,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    sc.errorReadback = CreateComputeDeviceBuffer(sc.device, errorBytes, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+    if (!sc.errorReadback) {
+        sc.errorReadback = CreateComputeDeviceBuffer(sc.device, errorBytes, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
+    if (!sc.errorBuffer || !sc.errorReadback) {
+        Log("[ERROR] Failed to allocate VRAM scan error buffers");
+        return false;
+    }
+
+    sc.errorMapped = static_cast<const uint32_t*>(sc.errorReadback.mappedPtr);
+    return true;
+}
+
+// Push constants selecting a pass's pattern in the kernels
+VRAMKernelParams GetVRAMKernelParams(const VRAMScanPass& pass) {
+    VRAMKernelParams params;
+    switch (pass.pattern) {
+        case VRAMTestPattern::AddressPattern:
+            params.kind = static_cast<uint32_t>(VRAMKernelKind::Address);
+            break;
+        case VRAMTestPattern::Random:
+            params.kind = static_cast<uint32_t>(VRAMKernelKind::Random);
+            params.value = Constants::VRAM_RANDOM_SEED + static_cast<uint32_t>(pass.iteration);
+            break;
+        default:
+            // Every other pattern is a single repeated dword
+            params.kind = static_cast<uint32_t>(VRAMKernelKind::Constant);
+            GenerateTestPattern(pass.pattern, &params.value, 1, pass.iteration);
+            break;
+    }
+    params.maxErrors = Constants::VRAM_SCAN_GPU_MAX_ERRORS;
+    return params;
+}
+
+// Builds the same clusters CompareBuffers() would from the verify kernel's
+// (unordered) mismatch records
+void ClusterErrorRecords(std::vector<VRAMErrorRecord>& records, VRAMTestPattern pattern,
+                         size_t chunkOffset, std::vector<VRAMError>& errors) {
+    std::sort(records.begin(), records.end(),
+              [](const VRAMErrorRecord& a, const VRAMErrorRecord& b) { return a.index < b.index; });
+
+    const size_t passFirstError = errors.size();
+    for (const auto& rec : records) {
+        size_t byteOffset = chunkOffset + static_cast<size_t>(rec.index) * sizeof(uint32_t);
+        if (errors.size() > passFirstError &&
+            byteOffset - errors.back().offsetEnd <= Constants::VRAM_ERROR_CLUSTER_DWORDS * sizeof(uint32_t)) {
+            errors.back().offsetEnd = byteOffset + sizeof(uint32_t);
+            errors.back().errorCount++;
+            continue;
+        }
+        VRAMError cluster = {};
+        cluster.offsetStart = byteOffset;
+        cluster.offsetEnd = byteOffset + sizeof(uint32_t);
+        cluster.expected = rec.expected;
+        cluster.actual = rec.actual;
+        cluster.pattern = pattern;
+        cluster.errorCount = 1;
+        errors.push_back(cluster);
+    }
+}
+
+// GPU-side counterpart of RunVRAMChunkPipeline(): one submission per pass
+// (clear counter, write, verify, copy the error records back).
+bool RunVRAMChunkCompute(VRAMComputeScanner& sc, const std::vector<VRAMScanPass>& passes,
+                         VkBufferAllocation& gpuBuffer, size_t chunkSize, size_t chunkOffset,
+                         const std::string& chunkLabel, std::vector<VRAMError>& errors,
+                         size_t& chunkErrors, float progressBase, float progressSpan) {
+    chunkSize &= ~static_cast<size_t>(3);
+    if (chunkSize == 0 || passes.empty()) return true;
+
+    // One descriptor set per window of the chunk
+    const size_t windowCount = (chunkSize + sc.windowSize - 1) / sc.windowSize;
+    auto windowBytes = [&](size_t window) -> size_t {
+        return std::min(sc.windowSize, chunkSize - window * sc.windowSize);
+    };
+
+    VK_CHECK_RETURN(vkResetDescriptorPool(sc.device, sc.descPool, 0), false);
+    std::vector<VkDescriptorSetLayout> setLayouts(windowCount, sc.descSetLayout);
+    std::vector<VkDescriptorSet> sets(windowCount, VK_NULL_HANDLE);
+    VkDescriptorSetAllocateInfo setAllocInfo = {};
+    setAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    setAllocInfo.descriptorPool = sc.descPool;
+    setAllocInfo.descriptorSetCount = static_cast<uint32_t>(windowCount);
+    setAllocInfo.pSetLayouts = setLayouts.data();
+    VK_CHECK_RETURN(vkAllocateDescriptorSets(sc.device, &setAllocInfo, sets.data()), false);
+
+    for (size_t w = 0; w < windowCount; ++w) {
+        VkDescriptorBufferInfo bufferDescs[2] = {};
+        bufferDescs[0].buffer = gpuBuffer.buffer;
+        bufferDescs[0].offset = static_cast<VkDeviceSize>(w * sc.windowSize);
+        bufferDescs[0].range = windowBytes(w);
+        bufferDescs[1].buffer = sc.errorBuffer.buffer;
+        bufferDescs[1].offset = 0;
+        bufferDescs[1].range = VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet writes[2] = {};
+        for (uint32_t b = 0; b < 2; ++b) {
+            writes[b].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[b].dstSet = sets[w];
+            writes[b].dstBinding = b;
+            writes[b].descriptorCount = 1;
+            writes[b].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writes[b].pBufferInfo = &bufferDescs[b];
+        }
+        vkUpdateDescriptorSets(sc.device, 2, writes, 0, nullptr);
+    }
+
+    auto barrier = [&](VkPipelineStageFlags srcStage, VkAccessFlags srcAccess,
+                       VkPipelineStageFlags dstStage, VkAccessFlags dstAccess) {
+        VkMemoryBarrier memBarrier = {};
+        memBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memBarrier.srcAccessMask = srcAccess;
+        memBarrier.dstAccessMask = dstAccess;
+        vkCmdPipelineBarrier(sc.cmd, srcStage, dstStage, 0, 1, &memBarrier, 0, nullptr, 0, nullptr);
+    };
+
+    auto dispatchWindows = [&](VkPipeline pipeline, VRAMKernelParams params) {
+        vkCmdBindPipeline(sc.cmd, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        for (size_t w = 0; w < windowCount; ++w) {
+            params.baseIndex = static_cast<uint32_t>(w * sc.windowSize / sizeof(uint32_t));
+            params.count = static_cast<uint32_t>(windowBytes(w) / sizeof(uint32_t));
+            uint32_t groups = (params.count + Constants::VRAM_SCAN_GPU_WORKGROUP - 1) / Constants::VRAM_SCAN_GPU_WORKGROUP;
+            groups = std::max(1u, std::min(groups, sc.maxGroups));
+
+            vkCmdBindDescriptorSets(sc.cmd, VK_PIPELINE_BIND_POINT_COMPUTE, sc.pipelineLayout,
+                                    0, 1, &sets[w], 0, nullptr);
+            vkCmdPushConstants(sc.cmd, sc.pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                               0, sizeof(VRAMKernelParams), &params);
+            vkCmdDispatch(sc.cmd, groups, 1, 1);
+        }
+    };
+
+    const VkAccessFlags shaderRW = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    const VkDeviceSize errorBytes = sc.errorBuffer.size;
+    std::vector<VRAMErrorRecord> records;
+
+    for (size_t pass = 0; pass < passes.size(); ++pass) {
+        if (g_app.vramTestCancelRequested) return false;
+
+        const VRAMScanPass& scanPass = passes[pass];
+        g_app.vramTestCurrentPattern = GetPatternName(scanPass.pattern) + " " + chunkLabel;
+        Bench().fenceTimeoutCount = 0;
+        VRAMKernelParams params = GetVRAMKernelParams(scanPass);
+
+        vkResetCommandBuffer(sc.cmd, 0);
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(sc.cmd, &beginInfo);
+
+        // Previous pass's verify / error copy -> this pass's counter clear and writes
+        barrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                shaderRW | VK_ACCESS_TRANSFER_READ_BIT,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                shaderRW | VK_ACCESS_TRANSFER_WRITE_BIT);
+        vkCmdFillBuffer(sc.cmd, sc.errorBuffer.buffer, 0, sizeof(uint32_t), 0);
+        barrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, shaderRW);
+
+        dispatchWindows(sc.writePipeline, params);
+        barrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, shaderRW);
+        dispatchWindows(sc.verifyPipeline, params);
+
+        barrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT);
+        VkBufferCopy errorRegion = { 0, 0, errorBytes };
+        vkCmdCopyBuffer(sc.cmd, sc.errorBuffer.buffer, sc.errorReadback.buffer, 1, &errorRegion);
+        barrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT);
+        vkEndCommandBuffer(sc.cmd);
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &sc.cmd;
+        VkResult submitResult = vkQueueSubmit(sc.queue, 1, &submitInfo, sc.fence);
+        if (submitResult != VK_SUCCESS) {
+            Log("[ERROR] vkQueueSubmit failed: " + std::to_string((int)submitResult));
+            return false;
+        }
+
+        FenceWaitResult waitResult = WaitForFenceEx(sc.fence, sc.device);
+        if (waitResult != FenceWaitResult::Success) {
+            if (waitResult != FenceWaitResult::Cancelled) {
+                Log("  [WARNING] " + GetPatternName(scanPass.pattern) +
+                    " failed (GPU fence wait during VRAM write/verify)");
+            }
+            // Don't let the caller free the chunk while the kernels may still run
+            uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL;
+            if (vkWaitForFences(sc.device, 1, &sc.fence, VK_TRUE, timeout) == VK_SUCCESS) {
+                vkResetFences(sc.device, 1, &sc.fence);
+            }
+            return false;
+        }
+
+        InvalidateMappedBuffer(sc.device, sc.errorReadback);
+
+        uint32_t mismatches = sc.errorMapped[0];
+        if (mismatches > 0) {
+            uint32_t recorded = std::min(mismatches, Constants::VRAM_SCAN_GPU_MAX_ERRORS);
+            records.resize(recorded);
+            memcpy(records.data(), sc.errorMapped + 1, recorded * sizeof(VRAMErrorRecord));
+            ClusterErrorRecords(records, scanPass.pattern, chunkOffset, errors);
+            chunkErrors += mismatches;
+            if (mismatches > recorded) {
+                Log("  [WARNING] " + GetPatternName(scanPass.pattern) + ": " + std::to_string(mismatches) +
+                    " mismatches, only " + std::to_string(recorded) +
+                    " were recorded (in no particular address order)");
+            }
+        }
+
+        g_app.vramTestProgress = progressBase + progressSpan *
+            (static_cast<float>(pass + 1) / static_cast<float>(passes.size()));
+    }
+
+    return !g_app.vramTestCancelRequested;
+}
+
+// ----------------------------------------------------------------------------
+// VRAM arena
+// ----------------------------------------------------------------------------
+// The scan claims device-local memory once, in large blocks, and binds each
+// chunk's VkBuffer at an offset inside them instead of doing a dedicated
+// vkAllocateMemory (and the driver's page-table work) per chunk. Holding all
+// blocks for the whole scan also guarantees every chunk is distinct physical
+// memory - freeing and reallocating tends to hand the same pages back.
+
+struct VRAMArenaBlock {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize   size = 0;
+    VkDeviceSize   arenaOffset = 0;  // Logical offset of the block's first byte
+};
+
+struct VRAMArena {
+    VkDevice                    device = VK_NULL_HANDLE;
+    VkBufferUsageFlags          usage = 0;
+    uint32_t                    memoryTypeIndex = UINT32_MAX;
+    VkDeviceSize                alignment = 1;  // Sub-range alignment (buffer requirement)
+    VkDeviceSize                totalSize = 0;
+    std::vector<VRAMArenaBlock> blocks;
+};
+
+// One chunk: a sub-range of one block
+struct VRAMArenaRange {
+    size_t       block = 0;
+    VkDeviceSize offset = 0;  // Within the block
+    VkDeviceSize size = 0;
+};
+
+void DestroyVRAMArena(VRAMArena& arena) {
+    for (auto& block : arena.blocks) {
+        if (block.memory != VK_NULL_HANDLE) vkFreeMemory(arena.device, block.memory, nullptr);
+    }
+    arena.blocks.clear();
+    arena.totalSize = 0;
+}
+
+// Claims up to targetSize bytes in blocks of maxBlockSize, halving the block
+// size on allocation failure down to minBlockSize. Returns false only if no
+// memory at all could be claimed (or on cancel).
+bool CreateVRAMArena(VRAMArena& arena, VkDevice device, VkBufferUsageFlags usage,
+                     size_t targetSize, size_t maxBlockSize, size_t minBlockSize) {
+    arena.device = device;
+    arena.usage = usage;
+
+    // Memory type and alignment come from a representative buffer
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = minBlockSize;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    VkBuffer probe = VK_NULL_HANDLE;
+    VK_CHECK_RETURN(vkCreateBuffer(device, &bufferInfo, nullptr, &probe), false);
+    VkMemoryRequirements memReqs;
+    vkGetBufferMemoryRequirements(device, probe, &memReqs);
+    vkDestroyBuffer(device, probe, nullptr);
+
+    arena.memoryTypeIndex = FindMemoryType(Bench().physicalDevice, memReqs.memoryTypeBits,
+                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    if (arena.memoryTypeIndex == UINT32_MAX) {
+        Log("[ERROR] No device-local memory type for the VRAM arena");
+        return false;
+    }
+    arena.alignment = std::max<VkDeviceSize>(memReqs.alignment, 1);
+
+    auto alignUp = [&](VkDeviceSize v) { return (v + arena.alignment - 1) / arena.alignment * arena.alignment; };
+
+    size_t blockSize = maxBlockSize;
+    while (arena.totalSize < targetSize && !g_app.vramTestCancelRequested) {
+        VkDeviceSize size = alignUp(std::min<VkDeviceSize>(blockSize, targetSize - arena.totalSize));
+
+        VkMemoryAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = size;
+        allocInfo.memoryTypeIndex = arena.memoryTypeIndex;
+
+        VRAMArenaBlock block;
+        if (vkAllocateMemory(device, &allocInfo, nullptr, &block.memory) == VK_SUCCESS) {
+            block.size = size;
+            block.arenaOffset = arena.totalSize;
+            arena.blocks.push_back(block);
+            arena.totalSize += size;
+            continue;
+        }
+
+        // Out of large contiguous allocations - try smaller blocks
+        if (blockSize / 2 < minBlockSize) break;
+        blockSize /= 2;
+    }
+
+    return !arena.blocks.empty() && !g_app.vramTestCancelRequested;
+}
+
+// Splits every block into chunkSize ranges. With rotation != 0 each block is
+// walked starting rotation bytes in (wrapping to the front), so chunk
+// boundaries - and the chunk-relative address/random data written to each
+// location - differ from a scan with another rotation.
+std::vector<VRAMArenaRange> PlanVRAMArenaRanges(const VRAMArena& arena, size_t chunkSize, size_t rotation) {
+    std::vector<VRAMArenaRange> ranges;
+    VkDeviceSize step = std::max<VkDeviceSize>(chunkSize / arena.alignment * arena.alignment, arena.alignment);
+
+    for (size_t b = 0; b < arena.blocks.size(); ++b) {
+        const VkDeviceSize blockSize = arena.blocks[b].size;
+        VkDeviceSize start = (rotation % blockSize) / arena.alignment * arena.alignment;
+
+        auto addRanges = [&](VkDeviceSize begin, VkDeviceSize end) {
+            for (VkDeviceSize offset = begin; offset < end; offset += step) {
+                ranges.push_back({ b, offset, std::min(step, end - offset) });
+            }
+        };
+        addRanges(start, blockSize);
+        addRanges(0, start);
+    }
+    return ranges;
+}
+
+// Buffer bound over one arena range. The memory belongs to the arena:
+// release with ReleaseVRAMArenaBuffer(), not VkBufferAllocation::Destroy().
+VkBufferAllocation BindVRAMArenaBuffer(const VRAMArena& arena, const VRAMArenaRange& range) {
+    VkBufferAllocation alloc = {};
+    const VRAMArenaBlock& block = arena.blocks[range.block];
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = range.size;
+    bufferInfo.usage = arena.usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VK_CHECK_RETURN(vkCreateBuffer(arena.device, &bufferInfo, nullptr, &alloc.buffer), alloc);
+
+    VkMemoryRequirements memReqs;
+    vkGetBufferMemoryRequirements(arena.device, alloc.buffer, &memReqs);
+    bool fits = (memReqs.memoryTypeBits & (1u << arena.memoryTypeIndex)) != 0 &&
+                range.offset % memReqs.alignment == 0 &&
+                range.offset + memReqs.size <= block.size;
+    VkResult result = fits ? vkBindBufferMemory(arena.device, alloc.buffer, block.memory, range.offset)
+                           : VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    if (result != VK_SUCCESS) {
+        Log("[ERROR] Failed to bind arena range " + FormatSize(range.size) + " at block offset " +
+            FormatSize(range.offset) + ": " + std::to_string((int)result));
+        vkDestroyBuffer(arena.device, alloc.buffer, nullptr);
+        alloc.buffer = VK_NULL_HANDLE;
+        return alloc;
+    }
+
+    alloc.memory = block.memory;
+    alloc.size = range.size;
+    return alloc;
+}
+
+void ReleaseVRAMArenaBuffer(const VRAMArena& arena, VkBufferAllocation& alloc) {
+    if (alloc.buffer != VK_NULL_HANDLE) vkDestroyBuffer(arena.device, alloc.buffer, nullptr);
+    alloc = {};
+}
+
+// Main VRAM test thread function
+void VRAMTestThreadFunc() {
+    auto startTime = std::chrono::steady_clock::now();
+    
+    Log("=== VRAM Scan Started ===");
+    Log("GPU: " + g_app.gpuList[g_app.config.selectedGPU].name);
+    Log("");
+    Log("DISCLAIMER: This is a basic VRAM integrity test using Vulkan.");
+    Log("It can detect obvious errors but is NOT a replacement for");
+    Log("vendor-specific tools like NVIDIA MATS or AMD memory diagnostics.");
+    Log("For chip-level diagnosis, use manufacturer tools.");
+    Log("");
+    
+    g_app.vramTestResult = {};
+    g_app.vramTestProgress = 0.0f;
+    
+    Bench().fenceTimeoutCount = 0;
+    g_app.benchmarkAborted = false;
+    
+    CleanupBenchmarkDevice();
+    ApplyGPUNumaPlacement(g_app.config.selectedGPU);
+    if (!InitBenchmarkDevice(g_app.config.selectedGPU)) {
+        Log("[ERROR] Failed to initialize benchmark device for VRAM test");
+        g_app.vramTestResult.completed = false;
+        g_app.vramTestRunning = false;
+        return;
+    }
+    
+    const GPUInfo& gpu = g_app.gpuList[g_app.config.selectedGPU];
+    
+    double targetPercent = g_app.vramTestFullScan ? 0.90 : Constants::VRAM_SAFETY_MARGIN;
+    size_t targetTestSize = static_cast<size_t>(gpu.dedicatedVRAM * targetPercent);
+    
+    if (g_app.vramTestFullScan) {
+        Log("FULL SCAN MODE: Attempting to test up to " + FormatSize(targetTestSize) + " (~90%) of VRAM");
+        Log("[WARNING] Full scan allocates maximum possible VRAM - may cause instability");
+    } else {
+        Log("Testing up to " + FormatSize(targetTestSize) + " (~80%) of VRAM");
+        Log("(Enable 'Full Scan' for more thorough testing)");
+    }
+    Log("");
+    
+    Log("NOTE: GPU drivers and OS reserve some VRAM for:");
+    Log("  - Command buffers and page tables");
+    Log("  - Desktop compositor (Wayland/X11)");
+    Log("  - Vulkan runtime scratch space");
+    Log("We test as much as can be allocated via Vulkan.");
+    Log("");
+    
+    std::vector<VRAMTestPattern> patterns = {
+        VRAMTestPattern::AllZeros,
+        VRAMTestPattern::AllOnes,
+        VRAMTestPattern::Checkerboard,
+        VRAMTestPattern::InverseCheckerboard,
+        VRAMTestPattern::AddressPattern,
+        VRAMTestPattern::Random
+    };
+    
+    const int MARCH_ITERATIONS = 4;
+    
+    // Pass order per chunk: basic patterns, then marching ones, then marching zeros
+    std::vector<VRAMScanPass> passes;
+    for (const auto& pattern : patterns) {
+        passes.push_back({ pattern, 0 });
+    }
+    for (int iter = 0; iter < MARCH_ITERATIONS; ++iter) {
+        passes.push_back({ VRAMTestPattern::MarchingOnes, iter });
+    }
+    for (int iter = 0; iter < MARCH_ITERATIONS; ++iter) {
+        passes.push_back({ VRAMTestPattern::MarchingZeros, iter });
+    }
+    
+    const size_t PREFERRED_CHUNK_SIZE = 512ull * 1024 * 1024;
+    const size_t MIN_CHUNK_SIZE = 128ull * 1024 * 1024;
+    const size_t ARENA_BLOCK_SIZE = 2 * PREFERRED_CHUNK_SIZE;
+    
+    // Preferred: write/verify in place with compute kernels, reading back only
+    // mismatches. Otherwise host generation/verification through staging, which
+    // is slice-sized and shared by all chunks; only VRAM is chunk-sized.
+    VRAMComputeScanner scanner;
+    VRAMScanPipeline pipeline;
+    bool gpuVerify = false;
+    if (g_app.vramTestGpuVerify) {
+        gpuVerify = CreateVRAMComputeScanner(scanner, PREFERRED_CHUNK_SIZE);
+        if (!gpuVerify) {
+            DestroyVRAMComputeScanner(scanner);
+            Log("[WARNING] GPU-side verification unavailable - falling back to host verification");
+        }
+    }
+    
+    auto releaseScanResources = [&]() {
+        DestroyVRAMComputeScanner(scanner);
+        DestroyVRAMScanPipeline(pipeline);
+        CleanupBenchmarkDevice();
+    };
+    
+    if (!gpuVerify &&
+        !CreateVRAMScanPipeline(pipeline, Constants::VRAM_SCAN_SLICE_SIZE, Constants::VRAM_SCAN_PIPELINE_SLOTS)) {
+        releaseScanResources();
+        g_app.vramTestResult.completed = false;
+        g_app.vramTestRunning = false;
+        return;
+    }
+    
+    // Chunks are sub-ranges of one arena on whichever device runs the scan
+    VRAMArena arena;
+    VkDevice chunkDevice = gpuVerify ? scanner.device : Bench().device;
+    VkBufferUsageFlags chunkUsage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    if (gpuVerify) chunkUsage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    
+    Log("Claiming VRAM arena...");
+    
+    if (!CreateVRAMArena(arena, chunkDevice, chunkUsage, targetTestSize, ARENA_BLOCK_SIZE, MIN_CHUNK_SIZE)) {
+        bool cancelled = g_app.vramTestCancelRequested;
+        if (!cancelled) {
+            Log("[ERROR] Failed to allocate test buffers even at " + FormatSize(MIN_CHUNK_SIZE));
+            Log("[ERROR] Try closing other applications to free VRAM");
+        }
+        DestroyVRAMArena(arena);
+        releaseScanResources();
+        g_app.vramTestResult.completed = false;
+        g_app.vramTestResult.cancelled = cancelled;
+        g_app.vramTestRunning = false;
+        return;
+    }
+    
+    if (arena.totalSize < targetTestSize) {
+        Log("[WARNING] Only " + FormatSize(arena.totalSize) + " of " + FormatSize(targetTestSize) +
+            " could be allocated - testing that");
+    }
+    
+    size_t chunkSize = std::min(PREFERRED_CHUNK_SIZE, static_cast<size_t>(arena.blocks.front().size));
+    size_t rotation = 0;
+    if (g_app.vramTestRotateOffsets) {
+        // A quarter chunk further into each block on every scan
+        rotation = static_cast<size_t>(g_app.vramTestScanCount) * (chunkSize / 4);
+    }
+    g_app.vramTestScanCount++;
+    
+    std::vector<VRAMArenaRange> ranges = PlanVRAMArenaRanges(arena, chunkSize, rotation);
+    size_t numChunks = ranges.size();
+    
+    double targetPercentDisplay = (static_cast<double>(arena.totalSize) / gpu.dedicatedVRAM) * 100.0;
+    char percentBuf[64];
+    snprintf(percentBuf, sizeof(percentBuf), "%.0f%%", targetPercentDisplay);
+    
+    Log("");
+    Log("Will test " + FormatSize(arena.totalSize) + " (" + percentBuf + " of VRAM) in " + 
+        std::to_string(numChunks) + " chunks of up to " + FormatSize(chunkSize));
+    Log("Each chunk: 6 basic patterns + marching ones + marching zeros");
+    if (gpuVerify) {
+        Log("Patterns written and verified on the GPU (compute queue family " +
+            std::to_string(scanner.queueFamily) + "); only mismatches are read back");
+    } else {
+        Log("Pipelined in " + FormatSize(pipeline.sliceSize) + " slices (" +
+            std::to_string(pipeline.slots.size()) + " staging slots: generate / DMA / verify overlap)");
+        Log("Host compare: " + std::string(GetDirtyBlockFinder().name) + " 64-byte block scan, " +
+            std::to_string(pipeline.workers.threads.size()) + " worker threads");
+    }
+    Log("Arena: " + std::to_string(arena.blocks.size()) + " block(s) held for the whole scan" +
+        (rotation != 0 ? ", chunk offsets rotated by " + FormatSize(rotation % arena.blocks.front().size)
+                       : std::string()));
+    Log("");
+    
+    size_t totalErrors = 0;
+    std::vector<VRAMError> allErrors;
+    bool hadCriticalFailure = false;
+    size_t totalBytesTested = 0;
+    
+    for (size_t chunkNum = 0; chunkNum < numChunks && !g_app.vramTestCancelRequested && !hadCriticalFailure; ++chunkNum) {
+        const VRAMArenaRange& range = ranges[chunkNum];
+        size_t chunkOffset = static_cast<size_t>(arena.blocks[range.block].arenaOffset + range.offset);
+        size_t thisChunkSize = static_cast<size_t>(range.size);
+        
+        Log("=== Chunk " + std::to_string(chunkNum + 1) + "/" + std::to_string(numChunks) + 
+            " (" + FormatSize(thisChunkSize) + " at logical offset " + FormatSize(chunkOffset) + ") ===");
+        
+        auto gpuBuffer = BindVRAMArenaBuffer(arena, range);
+        
+        if (!gpuBuffer) {
+            Log("[WARNING] Failed to bind buffer for chunk " + std::to_string(chunkNum + 1) + " - stopping");
+            ReleaseVRAMArenaBuffer(arena, gpuBuffer);
+            break;
+        }
+        
+        size_t chunkErrors = 0;
+        std::string chunkLabel = "[" + std::to_string(chunkNum + 1) + "/" + std::to_string(numChunks) + "]";
+        float progressSpan = 1.0f / static_cast<float>(numChunks);
+        
+        float progressBase = static_cast<float>(chunkNum) * progressSpan;
+        bool chunkOk = gpuVerify
+            ? RunVRAMChunkCompute(scanner, passes, gpuBuffer, thisChunkSize, chunkOffset,
+                                  chunkLabel, allErrors, chunkErrors, progressBase, progressSpan)
+            : RunVRAMChunkPipeline(pipeline, passes, gpuBuffer, thisChunkSize, chunkOffset,
+                                   chunkLabel, allErrors, chunkErrors, progressBase, progressSpan);
+        bool chunkFailed = !chunkOk || g_app.vramTestCancelRequested;
+        
+        ReleaseVRAMArenaBuffer(arena, gpuBuffer);
+        
+        if (!chunkFailed) {
+            totalBytesTested += thisChunkSize;
+        }
+        totalErrors += chunkErrors;
+        
+        std::string chunkResult = chunkFailed ? "INCOMPLETE" : 
+                                  (chunkErrors == 0) ? "PASS" : "FAIL (" + std::to_string(chunkErrors) + " errors)";
+        Log("  Chunk " + std::to_string(chunkNum + 1) + " result: " + chunkResult);
+        
+        if (chunkFailed && !g_app.vramTestCancelRequested) {
+            hadCriticalFailure = true;
+        }
+        
+        g_app.vramTestProgress = static_cast<float>(chunkNum + 1) / static_cast<float>(numChunks);
+    }
+    
+    double coveragePercent = (static_cast<double>(totalBytesTested) / gpu.dedicatedVRAM) * 100.0;
+    snprintf(percentBuf, sizeof(percentBuf), "%.1f%%", coveragePercent);
+    g_app.vramTestResult.patternResults.push_back(
+        std::to_string(totalBytesTested / (1024*1024)) + " MB tested (" + percentBuf + " coverage)");
+    
+    auto endTime = std::chrono::steady_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+    
+    g_app.vramTestResult.completed = !g_app.vramTestCancelRequested;
+    g_app.vramTestResult.cancelled = g_app.vramTestCancelRequested;
+    g_app.vramTestResult.totalBytesTested = totalBytesTested;
+    g_app.vramTestResult.totalErrors = totalErrors;
+    g_app.vramTestResult.errors = std::move(allErrors);
+    g_app.vramTestResult.testDurationSeconds = duration;
+    
+    Log("");
+    Log("=== VRAM Scan " + std::string(g_app.vramTestCancelRequested ? "Cancelled" : "Complete") + " ===");
+    snprintf(percentBuf, sizeof(percentBuf), "%.1f%%", coveragePercent);
+    Log("Tested: " + FormatSize(totalBytesTested) + " (" + percentBuf + " of " + FormatSize(gpu.dedicatedVRAM) + ")");
+    
+    char durationBuf[64];
+    snprintf(durationBuf, sizeof(durationBuf), "Duration: %.1f seconds", duration);
+    Log(durationBuf);
+    
+    if (totalErrors == 0) {
+        Log("Result: PASS - No errors detected");
+        g_app.vramTestResult.summary = "PASS - No errors in " + FormatSize(totalBytesTested) + " (" + percentBuf + " coverage)";
+    } else {
+        Log("Result: FAIL - " + std::to_string(totalErrors) + " total errors detected!");
+        g_app.vramTestResult.summary = "FAIL - " + std::to_string(totalErrors) + " errors in " + FormatSize(totalBytesTested);
+        
+        Log("");
+        Log("Error Regions:");
+        for (const auto& err : g_app.vramTestResult.errors) {
+            if (err.errorCount > 0) {
+                Log("  " + FormatErrorAddress(err.offsetStart) + " - " + 
+                    FormatErrorAddress(err.offsetEnd) + " (" + 
+                    std::to_string(err.errorCount) + " errors, pattern: " + 
+                    GetPatternName(err.pattern) + ")");
+            }
+        }
+        
+        Log("");
+        Log("NOTE: Error addresses are logical offsets in the test buffer,");
+        Log("not physical VRAM addresses. For chip-level diagnosis, use");
+        Log("vendor tools like NVIDIA MATS or AMD memory diagnostics.");
+    }
+    
+    Log("");
+    
+    DestroyVRAMArena(arena);
+    releaseScanResources();
+    
+    g_app.vramTestRunning = false;
+    g_app.vramTestProgress = 1.0f;
+    g_app.showVRAMTestWindow = true;
+}
+
+// ============================================================================
+// GPU MEMORY LATENCY TEST (Compute shader pointer-chase)
+// ============================================================================
+std::vector<uint32_t> GeneratePointerChaseChain(size_t numElements) {
+    std::vector<uint32_t> chain(numElements);
+    for (size_t i = 0; i < numElements; i++)
+        chain[i] = static_cast<uint32_t>(i);
+
+    // Sattolo's algorithm: guaranteed single cycle visiting all elements
+    std::mt19937 rng(42);  // Fixed seed for reproducibility
+    for (size_t i = numElements - 1; i > 0; i--) {
+        size_t j = std::uniform_int_distribution<size_t>(0, i - 1)(rng);
+        std::swap(chain[i], chain[j]);
+    }
+    return chain;
+}
+
+BenchmarkResult RunMemoryLatencyTest() {
+    BenchmarkResult result;
+    result.testName = "GPU Memory Latency";
+    result.unit = "ns";
+
+    SetCurrentTest("GPU Memory Latency");
+    g_app.progress = 0;
+
+    // ===== Create a SEPARATE VkDevice for compute work =====
+    // This isolates compute operations from the benchmark device's transfer queues.
+    // On AMD iGPUs, requesting queues from both compute (family 0) and dedicated transfer
+    // (family 1) on the same device causes driver-internal state corruption, leading to
+    // fence timeouts and GPU hangs during normal transfer operations.
+    // Using a separate device avoids this entirely.
+
+    VkDevice computeDevice = VK_NULL_HANDLE;
+    VkQueue computeQueue = VK_NULL_HANDLE;
+    VkCommandPool computeCommandPool = VK_NULL_HANDLE;
+    VkCommandBuffer computeCmdBuf = VK_NULL_HANDLE;
+    uint32_t computeFamily = UINT32_MAX;
+    double timestampPeriod = Bench().timestampPeriod;
+
+    // 1. Find a compute-capable queue family with timestamp support
+    uint32_t queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+    for (uint32_t i = 0; i < queueFamilyCount; i++) {
+        bool hasCompute = (queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0;
+        bool hasTimestamps = queueFamilies[i].timestampValidBits > 0;
+        if (hasCompute && hasTimestamps) {
+            computeFamily = i;
+            break;
+        }
+    }
+    if (computeFamily == UINT32_MAX) {
+        Log("[WARNING] No compute-capable queue with timestamps - skipping GPU memory latency test");
+        return result;
+    }
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Creating separate compute device (family " + std::to_string(computeFamily) + ") for memory latency test");
+
+    // 2. Create a separate VkDevice with ONLY the compute queue
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo computeQueueInfo = {};
+    computeQueueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    computeQueueInfo.queueFamilyIndex = computeFamily;
+    computeQueueInfo.queueCount = 1;
+    computeQueueInfo.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo deviceInfo = {};
+    deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceInfo.queueCreateInfoCount = 1;
+    deviceInfo.pQueueCreateInfos = &computeQueueInfo;
+
+    VkResult vr = vkCreateDevice(Bench().physicalDevice, &deviceInfo, nullptr, &computeDevice);
+    if (vr != VK_SUCCESS) {
+        Log("[ERROR] Failed to create compute device for memory latency test: " + std::to_string((int)vr));
+        return result;
+    }
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Compute device created successfully");
+
+    vkGetDeviceQueue(computeDevice, computeFamily, 0, &computeQueue);
+
+    // 3. Create command pool and buffer on compute device
+    VkCommandPoolCreateInfo poolCreateInfo = {};
+    poolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolCreateInfo.queueFamilyIndex = computeFamily;
+    if (vkCreateCommandPool(computeDevice, &poolCreateInfo, nullptr, &computeCommandPool) != VK_SUCCESS) {
+        Log("[ERROR] Failed to create compute command pool");
+        vkDestroyDevice(computeDevice, nullptr);
+        return result;
+    }
+
+    VkCommandBufferAllocateInfo cmdAllocInfo = {};
+    cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmdAllocInfo.commandPool = computeCommandPool;
+    cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cmdAllocInfo.commandBufferCount = 1;
+    if (vkAllocateCommandBuffers(computeDevice, &cmdAllocInfo, &computeCmdBuf) != VK_SUCCESS) {
+        Log("[ERROR] Failed to allocate compute command buffer");
+        vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
+        vkDestroyDevice(computeDevice, nullptr);
+        return result;
+    }
+
+    // ===== Now create all resources on the compute device =====
+
+    // 4. Create SPIR-V shader module
+    VkShaderModuleCreateInfo shaderInfo = {};
+    shaderInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    shaderInfo.codeSize = g_memoryLatencySPIRVSize;
+    shaderInfo.pCode = g_memoryLatencySPIRV;
+
+    VkShaderModule shaderModule = VK_NULL_HANDLE;
+    vr = vkCreateShaderModule(computeDevice, &shaderInfo, nullptr, &shaderModule);
+    if (vr != VK_SUCCESS) {
+        Log("[ERROR] Failed to create memory latency shader module: " + std::to_string((int)vr));
+        vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
+        vkDestroyDevice(computeDevice, nullptr);
+        return result;
+    }
+
+    // 5. Create descriptor set layout
+    VkDescriptorSetLayoutBinding storageBinding = {};
+    storageBinding.binding = 0;
+    storageBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    storageBinding.descriptorCount = 1;
+    storageBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.bindingCount = 1;
+    layoutInfo.pBindings = &storageBinding;
+
+    VkDescriptorSetLayout descSetLayout = VK_NULL_HANDLE;
+    vkCreateDescriptorSetLayout(computeDevice, &layoutInfo, nullptr, &descSetLayout);
+
+    // 6. Create pipeline layout with push constants
+    VkPushConstantRange pushRange = {};
+    pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushRange.offset = 0;
+    pushRange.size = 8;  // 2 x uint32: numChases, startIndex
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &descSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+
+    VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+    vkCreatePipelineLayout(computeDevice, &pipelineLayoutInfo, nullptr, &pipelineLayout);
+
+    // 7. Create compute pipeline
+    VkComputePipelineCreateInfo pipelineCreateInfo = {};
+    pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineCreateInfo.stage.module = shaderModule;
+    pipelineCreateInfo.stage.pName = "main";
+    pipelineCreateInfo.layout = pipelineLayout;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    vr = vkCreateComputePipelines(computeDevice, VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pipeline);
+    if (vr != VK_SUCCESS) {
+        Log("[ERROR] Failed to create compute pipeline: " + std::to_string((int)vr));
+        vkDestroyShaderModule(computeDevice, shaderModule, nullptr);
+        vkDestroyPipelineLayout(computeDevice, pipelineLayout, nullptr);
+        vkDestroyDescriptorSetLayout(computeDevice, descSetLayout, nullptr);
+        vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
+        vkDestroyDevice(computeDevice, nullptr);
+        return result;
+    }
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Compute pipeline created successfully");
+
+    // 8. Generate chain data
+    const size_t numElements = Constants::MEMORY_LATENCY_BUFFER_SIZE / sizeof(uint32_t);
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Generating pointer-chase chain (" + std::to_string(numElements) +
+            " elements, " + FormatSize(Constants::MEMORY_LATENCY_BUFFER_SIZE) + ")");
+    auto chainData = GeneratePointerChaseChain(numElements);
+
+    // 9. Create chain buffer (device-local, storage buffer) and a staging buffer to upload it
+    auto createLatencyBuffer = [&](VkBufferUsageFlags usage, VkMemoryPropertyFlags flags, const char* what,
+                                   VkBufferAllocation& buf, uint32_t& memType) -> bool {
+        VkBufferCreateInfo bufInfo = {};
+        bufInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufInfo.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
+        bufInfo.usage = usage;
+        bufInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        VkResult r = vkCreateBuffer(computeDevice, &bufInfo, nullptr, &buf.buffer);
+        if (r != VK_SUCCESS) {
+            buf.buffer = VK_NULL_HANDLE;
+            Log(std::string("[ERROR] Failed to create memory latency ") + what + " buffer: " + std::to_string((int)r));
+            return false;
+        }
+
+        VkMemoryRequirements memReqs;
+        vkGetBufferMemoryRequirements(computeDevice, buf.buffer, &memReqs);
+        memType = FindMemoryType(Bench().physicalDevice, memReqs.memoryTypeBits, flags);
+        if (memType == UINT32_MAX) {
+            Log(std::string("[ERROR] No memory type for the memory latency ") + what + " buffer");
+            return false;
+        }
+
+        VkMemoryAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = memReqs.size;
+        allocInfo.memoryTypeIndex = memType;
+        r = vkAllocateMemory(computeDevice, &allocInfo, nullptr, &buf.memory);
+        if (r != VK_SUCCESS) {
+            buf.memory = VK_NULL_HANDLE;
+            Log(std::string("[ERROR] Failed to allocate memory latency ") + what + " memory: " + std::to_string((int)r));
+            return false;
+        }
+        r = vkBindBufferMemory(computeDevice, buf.buffer, buf.memory, 0);
+        if (r != VK_SUCCESS) {
+            Log(std::string("[ERROR] Failed to bind memory latency ") + what + " memory: " + std::to_string((int)r));
+            return false;
+        }
+        buf.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
+        return true;
+    };
+
+    VkBufferAllocation chainBuffer = {};
+    VkBufferAllocation stagingBuffer = {};
+    uint32_t chainMemType = UINT32_MAX, stagingMemType = UINT32_MAX;
+    // 10. The staging buffer stays mapped until stagingBuffer.Destroy()
+    bool chainReady =
+        createLatencyBuffer(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, "chain", chainBuffer, chainMemType) &&
+        createLatencyBuffer(VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                            "staging", stagingBuffer, stagingMemType) &&
+        MapBufferAllocation(computeDevice, stagingBuffer, stagingMemType);
+    if (!chainReady) {
+        // Without the chain upload the shader would chase uninitialised memory
+        Log("[ERROR] Failed to set up the pointer-chase chain - skipping GPU memory latency test");
+        stagingBuffer.Destroy(computeDevice);
+        chainBuffer.Destroy(computeDevice);
+        vkDestroyPipeline(computeDevice, pipeline, nullptr);
+        vkDestroyPipelineLayout(computeDevice, pipelineLayout, nullptr);
+        vkDestroyDescriptorSetLayout(computeDevice, descSetLayout, nullptr);
+        vkDestroyShaderModule(computeDevice, shaderModule, nullptr);
+        vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
+        vkDestroyDevice(computeDevice, nullptr);
+        return result;
+    }
+    memcpy(stagingBuffer.mappedPtr, chainData.data(), Constants::MEMORY_LATENCY_BUFFER_SIZE);
+
+    // Upload chain data via compute queue (compute families implicitly support transfer)
+    {
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(computeCmdBuf, &beginInfo);
+
+        VkBufferCopy copyRegion = {};
+        copyRegion.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
+        vkCmdCopyBuffer(computeCmdBuf, stagingBuffer.buffer, chainBuffer.buffer, 1, &copyRegion);
+
+        // Barrier: transfer write -> shader read (same queue family, no ownership transfer)
+        VkBufferMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = chainBuffer.buffer;
+        barrier.offset = 0;
+        barrier.size = VK_WHOLE_SIZE;
+        vkCmdPipelineBarrier(computeCmdBuf,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+        vkEndCommandBuffer(computeCmdBuf);
+
+        VkFence uploadFence = VK_NULL_HANDLE;
+        VkFenceCreateInfo fenceCI = {};
+        fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        vkCreateFence(computeDevice, &fenceCI, nullptr, &uploadFence);
+
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &computeCmdBuf;
+        vkQueueSubmit(computeQueue, 1, &submitInfo, uploadFence);
+        vkWaitForFences(computeDevice, 1, &uploadFence, VK_TRUE, UINT64_MAX);
+        vkDestroyFence(computeDevice, uploadFence, nullptr);
+    }
+
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Chain data uploaded successfully (" + FormatSize(Constants::MEMORY_LATENCY_BUFFER_SIZE) + ")");
+
+    // Free staging buffer
+    stagingBuffer.Destroy(computeDevice);
+
+    // 11. Create descriptor pool and set
+    VkDescriptorPoolSize descPoolSize = {};
+    descPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descPoolSize.descriptorCount = 1;
+
+    VkDescriptorPoolCreateInfo descPoolInfo = {};
+    descPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descPoolInfo.maxSets = 1;
+    descPoolInfo.poolSizeCount = 1;
+    descPoolInfo.pPoolSizes = &descPoolSize;
+
+    VkDescriptorPool descPool = VK_NULL_HANDLE;
+    vkCreateDescriptorPool(computeDevice, &descPoolInfo, nullptr, &descPool);
+
+    VkDescriptorSetAllocateInfo descAllocInfo = {};
+    descAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    descAllocInfo.descriptorPool = descPool;
+    descAllocInfo.descriptorSetCount = 1;
+    descAllocInfo.pSetLayouts = &descSetLayout;
+
+    VkDescriptorSet descSet = VK_NULL_HANDLE;
+    vkAllocateDescriptorSets(computeDevice, &descAllocInfo, &descSet);
+
+    // Update descriptor set
+    VkDescriptorBufferInfo bufferDesc = {};
+    bufferDesc.buffer = chainBuffer.buffer;
+    bufferDesc.offset = 0;
+    bufferDesc.range = VK_WHOLE_SIZE;
+
+    VkWriteDescriptorSet writeDesc = {};
+    writeDesc.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDesc.dstSet = descSet;
+    writeDesc.dstBinding = 0;
+    writeDesc.descriptorCount = 1;
+    writeDesc.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writeDesc.pBufferInfo = &bufferDesc;
+
+    vkUpdateDescriptorSets(computeDevice, 1, &writeDesc, 0, nullptr);
+
+    // 12. Create timestamp query pool
+    VkQueryPoolCreateInfo queryPoolInfo = {};
+    queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolInfo.queryCount = 2;
+
+    VkQueryPool queryPool = VK_NULL_HANDLE;
+    vkCreateQueryPool(computeDevice, &queryPoolInfo, nullptr, &queryPool);
+
+    // Fence for dispatch synchronization
+    VkFence dispatchFence = VK_NULL_HANDLE;
+    {
+        VkFenceCreateInfo fenceCI = {};
+        fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        vkCreateFence(computeDevice, &fenceCI, nullptr, &dispatchFence);
+    }
+
+    // Push constants
+    struct LatencyParams {
+        uint32_t numChases;
+        uint32_t startIndex;
+    };
+    LatencyParams params = { Constants::MEMORY_LATENCY_NUM_CHASES, 0 };
+
+    // 13. Warmup dispatches
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Running " + std::to_string(Constants::MEMORY_LATENCY_WARMUP_DISPATCHES) + " warmup dispatches...");
+    for (int w = 0; w < Constants::MEMORY_LATENCY_WARMUP_DISPATCHES && !ShouldAbortBenchmark(); w++) {
+        vkResetCommandBuffer(computeCmdBuf, 0);
+
+        VkCommandBufferBeginInfo beginInfo = {};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(computeCmdBuf, &beginInfo);
+
+        vkCmdBindPipeline(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        vkCmdBindDescriptorSets(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
+            pipelineLayout, 0, 1, &descSet, 0, nullptr);
+        vkCmdPushConstants(computeCmdBuf, pipelineLayout,
+            VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(params), &params);
+        vkCmdDispatch(computeCmdBuf, 1, 1, 1);
+
+        vkEndCommandBuffer(computeCmdBuf);
+
+        vkResetFences(computeDevice, 1, &dispatchFence);
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &computeCmdBuf;
+        vr = vkQueueSubmit(computeQueue, 1, &submitInfo, dispatchFence);
+        if (vr != VK_SUCCESS) {
+            Log("[ERROR] Warmup dispatch " + std::to_string(w) + " submit failed: " + std::to_string((int)vr));
+        }
+        vr = vkWaitForFences(computeDevice, 1, &dispatchFence, VK_TRUE, Constants::FENCE_WAIT_TIMEOUT_MS * 1000000ULL);
+        if (vr != VK_SUCCESS) {
+            Log("[ERROR] Warmup dispatch " + std::to_string(w) + " fence wait failed: " + std::to_string((int)vr));
+        }
+    }
+
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Warmup dispatches complete");
+
+    if (ShouldAbortBenchmark()) goto cleanup;
+
+    // 14. Measurement dispatches
+    {
+        if (g_app.config.debugLogging)
+            Log("[DEBUG] Running " + std::to_string(Constants::MEMORY_LATENCY_MEASURE_DISPATCHES) + " measurement dispatches...");
+        int totalDispatches = Constants::MEMORY_LATENCY_MEASURE_DISPATCHES;
+
+        for (int m = 0; m < totalDispatches && !ShouldAbortBenchmark(); m++) {
+            vkResetCommandBuffer(computeCmdBuf, 0);
+
+            VkCommandBufferBeginInfo beginInfo = {};
+            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            vkBeginCommandBuffer(computeCmdBuf, &beginInfo);
+
+            // Reset and write start timestamp
+            vkCmdResetQueryPool(computeCmdBuf, queryPool, 0, 2);
+            vkCmdWriteTimestamp(computeCmdBuf, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, 0);
+
+            // Bind and dispatch
+            vkCmdBindPipeline(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+            vkCmdBindDescriptorSets(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
+                pipelineLayout, 0, 1, &descSet, 0, nullptr);
+            vkCmdPushConstants(computeCmdBuf, pipelineLayout,
+                VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(params), &params);
+            vkCmdDispatch(computeCmdBuf, 1, 1, 1);
+
+            // Write end timestamp
+            vkCmdWriteTimestamp(computeCmdBuf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, queryPool, 1);
+
+            vkEndCommandBuffer(computeCmdBuf);
+
+            vkResetFences(computeDevice, 1, &dispatchFence);
+            VkSubmitInfo submitInfo = {};
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.commandBufferCount = 1;
+            submitInfo.pCommandBuffers = &computeCmdBuf;
+            vr = vkQueueSubmit(computeQueue, 1, &submitInfo, dispatchFence);
+            if (vr != VK_SUCCESS) {
+                Log("[ERROR] Measurement dispatch " + std::to_string(m) + " submit failed: " + std::to_string((int)vr));
+                continue;
+            }
+            vr = vkWaitForFences(computeDevice, 1, &dispatchFence, VK_TRUE, Constants::FENCE_WAIT_TIMEOUT_MS * 1000000ULL);
+            if (vr != VK_SUCCESS) {
+                Log("[ERROR] Measurement dispatch " + std::to_string(m) + " fence wait failed: " + std::to_string((int)vr));
+                continue;
+            }
+
+            // Read timestamps
+            uint64_t timestamps[2] = {};
+            vr = vkGetQueryPoolResults(computeDevice, queryPool, 0, 2,
+                sizeof(timestamps), timestamps, sizeof(uint64_t),
+                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+
+            if (g_app.config.debugLogging && m == 0) {
+                Log("[DEBUG] Timestamp query result: " + std::to_string((int)vr) +
+                    ", ts[0]=" + std::to_string(timestamps[0]) +
+                    ", ts[1]=" + std::to_string(timestamps[1]) +
+                    ", period=" + std::to_string(timestampPeriod) + " ns/tick");
+            }
+
+            if (vr == VK_SUCCESS && timestamps[1] > timestamps[0]) {
+                double totalNs = static_cast<double>(timestamps[1] - timestamps[0]) * timestampPeriod;
+                double perChaseNs = totalNs / Constants::MEMORY_LATENCY_NUM_CHASES;
+                result.samples.push_back(perChaseNs);
+                result.histogram.Record(perChaseNs);
+            } else if (m == 0) {
+                Log("[WARNING] Invalid timestamps on first measurement: vr=" + std::to_string((int)vr) +
+                    " ts[0]=" + std::to_string(timestamps[0]) +
+                    " ts[1]=" + std::to_string(timestamps[1]));
+            }
+
+            g_app.progress = static_cast<float>(m + 1) / totalDispatches;
+        }
+    }
+
+    // 15. Calculate statistics
+    if (g_app.config.debugLogging)
+        Log("[DEBUG] Memory latency test collected " + std::to_string(result.samples.size()) + " valid samples");
+
+    if (!result.samples.empty()) {
+        std::sort(result.samples.begin(), result.samples.end());
+        result.minValue = result.samples.front();
+        result.maxValue = result.samples.back();
+        double sum = 0;
+        for (double s : result.samples) sum += s;
+        result.avgValue = sum / result.samples.size();
+
+        if (g_app.config.debugLogging)
+            Log("[DEBUG] GPU Memory Latency: min=" + std::to_string(result.minValue) +
+                " avg=" + std::to_string(result.avgValue) +
+                " max=" + std::to_string(result.maxValue) + " ns");
+    } else {
+        Log("[WARNING] No valid memory latency samples collected");
+    }
+
+cleanup:
+    // 16. Cleanup — destroy everything on the compute device, then destroy the device itself
+    vkDeviceWaitIdle(computeDevice);
+    vkDestroyFence(computeDevice, dispatchFence, nullptr);
+    vkDestroyQueryPool(computeDevice, queryPool, nullptr);
+    vkDestroyDescriptorPool(computeDevice, descPool, nullptr);
+    chainBuffer.Destroy(computeDevice);
+    vkDestroyPipeline(computeDevice, pipeline, nullptr);
+    vkDestroyPipelineLayout(computeDevice, pipelineLayout, nullptr);
+    vkDestroyDescriptorSetLayout(computeDevice, descSetLayout, nullptr);
+    vkDestroyShaderModule(computeDevice, shaderModule, nullptr);
+    vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
+    vkDestroyDevice(computeDevice, nullptr);
+
+    return result;
+}
+
+// Bandwidth and latency tests repeated with imported application pages in
+// place of driver-allocated staging. Result names carry the page mode each host
+// buffer actually got, so they land next to the staging results in the table
+// and CSV without claiming HugeTLB after a THP fallback.
+void RunImportedHostTests(const std::string& runSuffix, bool useRoundTrip, std::vector<BenchmarkResult>& allResults) {
+    const HostPageMode mode = g_app.config.hostPageMode;
+    auto tagFor = [](const VkBufferAllocation& host) {
+        return std::string(" [imported ") + HostPageModeName(host.hostPageMode) + "]";
+    };
+    const size_t size = g_app.config.bandwidthSize;
+    auto advance = [](int tests) {
+        g_app.completedTests += tests;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    };
+    const int latencyTests = g_app.config.runLatency ? 2 : 0;
+
+    auto hostReadback = CreateImportedHostBuffer(VkBufferType::Readback, size, mode);
+    auto hostUpload = CreateImportedHostBuffer(VkBufferType::Upload, size, mode);
+    auto gpuBuffer = CreateBuffer(VkBufferType::DeviceLocal, size);
+    if (!hostReadback || !hostUpload || !gpuBuffer) {
+        Log("[ERROR] Failed to create imported host buffers - skipping imported host tests");
+        hostReadback.Destroy(Bench().device);
+        hostUpload.Destroy(Bench().device);
+        gpuBuffer.Destroy(Bench().device);
+        advance(2 + latencyTests);
+        return;
+    }
+
+    double downloadSpeed = 0.0;
+    std::string tag = tagFor(hostReadback);
+    auto resDownload = RunBandwidthTest("GPU->CPU " + FormatSize(size) + tag + runSuffix, gpuBuffer, hostReadback,
+                                        size, g_app.config.copiesPerBatch, g_app.config.bandwidthBatches);
+    if (!resDownload.samples.empty()) {
+        allResults.push_back(resDownload);
+        downloadSpeed = resDownload.avgValue;
+        Log("  GPU->CPU" + tag + ": " + std::to_string(resDownload.avgValue).substr(0, 5) + " GB/s");
+    }
+    advance(1);
+
+    if (!ShouldAbortBenchmark()) {
+        tag = tagFor(hostUpload);
+        auto resUpload = RunBandwidthTest("CPU->GPU " + FormatSize(size) + tag + runSuffix, hostUpload, gpuBuffer,
+                                          size, g_app.config.copiesPerBatch, g_app.config.bandwidthBatches,
+                                          useRoundTrip, downloadSpeed, &hostReadback);
+        if (!resUpload.samples.empty()) {
+            allResults.push_back(resUpload);
+            Log("  CPU->GPU" + tag + ": " + std::to_string(resUpload.avgValue).substr(0, 5) + " GB/s");
+        }
+        advance(1);
+    }
+
+    hostReadback.Destroy(Bench().device);
+    hostUpload.Destroy(Bench().device);
+    gpuBuffer.Destroy(Bench().device);
+    if (latencyTests == 0 || ShouldAbortBenchmark()) return;
+
+    const size_t latSize = g_app.config.latencySize;
+    auto latUpload = CreateImportedHostBuffer(VkBufferType::Upload, latSize, mode);
+    auto latReadback = CreateImportedHostBuffer(VkBufferType::Readback, latSize, mode);
+    auto latGpu = CreateBuffer(VkBufferType::DeviceLocal, latSize);
+    if (latUpload && latReadback && latGpu) {
+        RunLatencyTest("Warm-up Upload", latUpload, latGpu, Constants::LATENCY_WARMUP_ITERATIONS);
+        tag = tagFor(latUpload);
+        auto resUpLat = RunLatencyTest("CPU->GPU Latency" + tag + runSuffix, latUpload, latGpu, g_app.config.latencyIters);
+        if (!resUpLat.samples.empty()) {
+            allResults.push_back(resUpLat);
+            Log("  CPU->GPU Latency" + tag + ": " + std::to_string(resUpLat.avgValue).substr(0, 6) + " us");
+        }
+        advance(1);
+        if (!ShouldAbortBenchmark()) {
+            tag = tagFor(latReadback);
+            auto resDownLat = RunLatencyTest("GPU->CPU Latency" + tag + runSuffix, latGpu, latReadback, g_app.config.latencyIters);
+            if (!resDownLat.samples.empty()) {
+                allResults.push_back(resDownLat);
+                Log("  GPU->CPU Latency" + tag + ": " + std::to_string(resDownLat.avgValue).substr(0, 6) + " us");
+            }
+            advance(1);
+        }
+    } else {
+        Log("[ERROR] Failed to create imported host latency buffers");
+        advance(latencyTests);
+    }
+    latUpload.Destroy(Bench().device);
+    latReadback.Destroy(Bench().device);
+    latGpu.Destroy(Bench().device);
+}
+
+// Upload/download from imported host pages mbind'ed to the GPU's node and then
+// to another node, with the thread following the pages each time. Driver
+// staging allocated under set_mempolicy isn't guaranteed to land on the bound
+// node, so both sides use explicit placement and are checked page by page.
+bool MeasureNumaNodeBandwidth(int node, const std::string& cpuList, const std::string& label, bool useRoundTrip,
+                              double& upload, double& download, std::vector<BenchmarkResult>& allResults) {
+    const std::string tag = " [" + label + " node " + std::to_string(node) + "]";
+    const size_t size = g_app.config.bandwidthSize;
+    ApplyNumaPlacement(node, ParseCpuList(cpuList));
+
+    auto gpuBuffer = CreateBuffer(VkBufferType::DeviceLocal, size);
+    auto cpuReadback = CreateImportedHostBuffer(VkBufferType::Readback, size, HostPageMode::Normal, node);
+    auto cpuUpload = CreateImportedHostBuffer(VkBufferType::Upload, size, HostPageMode::Normal, node);
+    bool measured = false;
+    if (!gpuBuffer || !cpuReadback || !cpuUpload) {
+        Log("[ERROR] Failed to allocate " + label + "-node staging buffers");
+    } else if (!VerifyNumaPlacement(cpuReadback.mappedPtr, size, node) ||
+               !VerifyNumaPlacement(cpuUpload.mappedPtr, size, node)) {
+        Log("[WARNING] NUMA: " + label + " staging pages are not on node " + std::to_string(node) +
+            " - skipping the remote node comparison");
+    } else {
+        auto resDownload = RunBandwidthTest("GPU->CPU " + FormatSize(size) + tag, gpuBuffer, cpuReadback,
+                                            size, g_app.config.copiesPerBatch, g_app.config.bandwidthBatches);
+        if (!resDownload.samples.empty()) {
+            allResults.push_back(resDownload);
+            download = resDownload.avgValue;
+        }
+        if (!ShouldAbortBenchmark()) {
+            auto resUpload = RunBandwidthTest("CPU->GPU " + FormatSize(size) + tag, cpuUpload, gpuBuffer,
+                                              size, g_app.config.copiesPerBatch, g_app.config.bandwidthBatches,
+                                              useRoundTrip, download, &cpuReadback);
+            if (!resUpload.samples.empty()) {
+                allResults.push_back(resUpload);
+                upload = resUpload.avgValue;
+            }
+        }
+        measured = true;
+    }
+    gpuBuffer.Destroy(Bench().device);
+    cpuReadback.Destroy(Bench().device);
+    cpuUpload.Destroy(Bench().device);
+    return measured;
 }
 
-// ============================================================================
-// GPU MEMORY LATENCY TEST (Compute shader pointer-chase)
-// ============================================================================
-std::vector<uint32_t> GeneratePointerChaseChain(size_t numElements) {
-    std::vector<uint32_t> chain(numElements);
-    for (size_t i = 0; i < numElements; i++)
-        chain[i] = static_cast<uint32_t>(i);
+void RunNumaRemoteComparison(bool useRoundTrip, std::vector<BenchmarkResult>& allResults) {
+    const GPUInfo& gpu = g_app.gpuList[g_app.config.selectedGPU];
+    NumaComparisonResult comparison;
+    comparison.localNode = gpu.numaNode;
+    comparison.remoteNode = gpu.numaNode < 0 ? -1 : FindRemoteNumaNode(gpu.numaNode);
+    if (comparison.remoteNode < 0) {
+        Log("[INFO] NUMA: no remote node to compare against (single-node system?)");
+        return;
+    }
+    if (!Bench().getMemoryHostPointerProperties) {
+        Log("[INFO] NUMA: host memory import unavailable on this device - can't place staging on a node, skipping");
+        return;
+    }
 
-    // Sattolo's algorithm: guaranteed single cycle visiting all elements
-    std::mt19937 rng(42);  // Fixed seed for reproducibility
-    for (size_t i = numElements - 1; i > 0; i--) {
-        size_t j = std::uniform_int_distribution<size_t>(0, i - 1)(rng);
-        std::swap(chain[i], chain[j]);
+    SetCurrentTest("Remote NUMA Node");
+    Log("--- Remote NUMA node " + std::to_string(comparison.remoteNode) + " (GPU on node " +
+        std::to_string(comparison.localNode) + ") ---");
+    bool measured = MeasureNumaNodeBandwidth(comparison.localNode, gpu.localCpuList, "local", useRoundTrip,
+                                             comparison.localUpload, comparison.localDownload, allResults);
+    if (measured && !ShouldAbortBenchmark()) {
+        measured = MeasureNumaNodeBandwidth(comparison.remoteNode, NumaNodeCpuList(comparison.remoteNode), "remote",
+                                            useRoundTrip, comparison.remoteUpload, comparison.remoteDownload,
+                                            allResults);
     }
-    return chain;
+
+    // Back to the local node (or the default policy) for whatever runs next
+    if (g_app.config.numaPlacement) {
+        ApplyNumaPlacement(gpu.numaNode, ParseCpuList(gpu.localCpuList));
+    } else {
+        ApplyNumaPlacement(-1, {});
+    }
+    if (!measured || ShouldAbortBenchmark()) return;
+
+    const double localUpload = comparison.localUpload, localDownload = comparison.localDownload;
+    auto penalty = [](double local, double remote) { return local > 0 ? (1.0 - remote / local) * 100.0 : 0.0; };
+    char line[192];
+    snprintf(line, sizeof(line), "  Cross-socket penalty: CPU->GPU %.2f -> %.2f GB/s (%.1f%%), GPU->CPU %.2f -> %.2f GB/s (%.1f%%)",
+             localUpload, comparison.remoteUpload, penalty(localUpload, comparison.remoteUpload),
+             localDownload, comparison.remoteDownload, penalty(localDownload, comparison.remoteDownload));
+    Log(line);
+
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.numaComparison = comparison;
 }
 
-BenchmarkResult RunMemoryLatencyTest() {
-    BenchmarkResult result;
-    result.testName = "GPU Memory Latency";
-    result.unit = "ns";
+// ----------------------------------------------------------------------------
+// CPU direct access to VRAM
+// ----------------------------------------------------------------------------
+// With a BAR mapping (all of VRAM under ReBAR) the CPU can store straight
+// into DEVICE_LOCAL | HOST_VISIBLE memory instead of filling a staging buffer
+// for the DMA engine. That memory is write-combined: plain stores get merged
+// in WC buffers, streaming (non-temporal) stores skip the cache entirely, and
+// reads are uncached - only MOVNTDQA streaming loads fetch whole lines.
+
+// Plain copy: whatever the libc memcpy picks
+void DirectCopyPlain(void* dst, const void* src, size_t bytes) {
+    memcpy(dst, src, bytes);
+}
 
-    g_app.currentTest = "GPU Memory Latency";
-    g_app.progress = 0;
+#ifdef VRAM_COMPARE_X86
+// Streaming stores, one 64-byte line per iteration. dst/src 16-byte aligned;
+// a partial last line is copied with memcpy.
+void DirectCopyStreamStore(void* dst, const void* src, size_t bytes) {
+    __m128i* d = static_cast<__m128i*>(dst);
+    const __m128i* s = static_cast<const __m128i*>(src);
+    const size_t lineBytes = bytes / 64 * 64;
+    for (size_t i = 0; i < lineBytes / sizeof(__m128i); i += 4) {
+        __m128i a = _mm_load_si128(s + i + 0), b = _mm_load_si128(s + i + 1);
+        __m128i c = _mm_load_si128(s + i + 2), e = _mm_load_si128(s + i + 3);
+        _mm_stream_si128(d + i + 0, a);
+        _mm_stream_si128(d + i + 1, b);
+        _mm_stream_si128(d + i + 2, c);
+        _mm_stream_si128(d + i + 3, e);
+    }
+    _mm_sfence();
+    memcpy(static_cast<char*>(dst) + lineBytes, static_cast<const char*>(src) + lineBytes, bytes - lineBytes);
+}
 
-    // ===== Create a SEPARATE VkDevice for compute work =====
-    // This isolates compute operations from the benchmark device's transfer queues.
-    // On AMD iGPUs, requesting queues from both compute (family 0) and dedicated transfer
-    // (family 1) on the same device causes driver-internal state corruption, leading to
-    // fence timeouts and GPU hangs during normal transfer operations.
-    // Using a separate device avoids this entirely.
+// Streaming loads (SSE4.1 MOVNTDQA) out of write-combining memory. Same
+// alignment and tail handling as DirectCopyStreamStore().
+__attribute__((target("sse4.1")))
+void DirectCopyStreamLoad(void* dst, const void* src, size_t bytes) {
+    __m128i* d = static_cast<__m128i*>(dst);
+    __m128i* s = static_cast<__m128i*>(const_cast<void*>(src));
+    const size_t lineBytes = bytes / 64 * 64;
+    for (size_t i = 0; i < lineBytes / sizeof(__m128i); i += 4) {
+        __m128i a = _mm_stream_load_si128(s + i + 0), b = _mm_stream_load_si128(s + i + 1);
+        __m128i c = _mm_stream_load_si128(s + i + 2), e = _mm_stream_load_si128(s + i + 3);
+        _mm_store_si128(d + i + 0, a);
+        _mm_store_si128(d + i + 1, b);
+        _mm_store_si128(d + i + 2, c);
+        _mm_store_si128(d + i + 3, e);
+    }
+    memcpy(static_cast<char*>(dst) + lineBytes, static_cast<const char*>(src) + lineBytes, bytes - lineBytes);
+}
+#endif
 
-    VkDevice computeDevice = VK_NULL_HANDLE;
-    VkQueue computeQueue = VK_NULL_HANDLE;
-    VkCommandPool computeCommandPool = VK_NULL_HANDLE;
-    VkCommandBuffer computeCmdBuf = VK_NULL_HANDLE;
-    uint32_t computeFamily = UINT32_MAX;
-    double timestampPeriod = g_app.benchTimestampPeriod;
+// Write and read a mapped device-local buffer from 1..N CPU threads, plain and
+// streaming, and set the results against the DMA averages of the regular runs
+void RunDirectAccessTest(double dmaUpload, double dmaDownload, std::vector<BenchmarkResult>& allResults) {
+    const GPUInfo& gpu = g_app.gpuList[g_app.config.selectedGPU];
+    if (gpu.cpuVisibleVRAM == 0) {
+        Log("[INFO] No CPU-visible device-local memory - skipping direct access test");
+        return;
+    }
 
-    // 1. Find a compute-capable queue family with timestamp support
+    // Stay well inside a legacy 256 MB window; the driver keeps part of it
+    const size_t lineBytes = 64;
+    size_t size = std::min(g_app.config.bandwidthSize, gpu.cpuVisibleVRAM / 4);
+    size = size / (lineBytes * Constants::DIRECT_ACCESS_MAX_THREADS) * (lineBytes * Constants::DIRECT_ACCESS_MAX_THREADS);
+
+    SetCurrentTest("CPU Direct Access");
+    Log("--- CPU direct access: " + FormatSize(size) + (gpu.hasReBAR ? " (Resizable BAR) ---" : " (BAR window) ---"));
+
+    auto vram = CreateBuffer(VkBufferType::DeviceLocalMapped, size);
+    void* host = aligned_alloc(lineBytes, size);
+    if (!vram || !host) {
+        Log("[ERROR] Failed to allocate mapped VRAM or host buffer for the direct access test");
+        vram.Destroy(Bench().device);
+        free(host);
+        return;
+    }
+    memset(host, 0x5A, size);
+
+    size_t availableCpus = std::max(1u, std::thread::hardware_concurrency());
+    if (g_app.config.numaPlacement && gpu.numaNode >= 0) {
+        availableCpus = std::max<size_t>(1, ParseCpuList(gpu.localCpuList).size());
+    }
+    std::vector<size_t> threadCounts = { 1 };
+    size_t maxThreads = std::min<size_t>(availableCpus, Constants::DIRECT_ACCESS_MAX_THREADS);
+    if (maxThreads > 1) threadCounts.push_back(maxThreads);
+
+    struct DirectMode {
+        const char* label;
+        bool        write;
+        void      (*copy)(void*, const void*, size_t);
+    };
+    std::vector<DirectMode> modes = {
+        { "Write plain",     true,  DirectCopyPlain },
+        { "Read plain",      false, DirectCopyPlain },
+    };
+#ifdef VRAM_COMPARE_X86
+    modes.insert(modes.begin() + 1, { "Write streaming", true, DirectCopyStreamStore });
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.1")) modes.push_back({ "Read streaming", false, DirectCopyStreamLoad });
+#endif
+
+    const int passes = std::min(g_app.config.bandwidthBatches, Constants::DIRECT_ACCESS_MAX_PASSES);
+    double bestWrite = 0.0, bestRead = 0.0;
+    std::string bestWriteName, bestReadName;
+
+    for (size_t threads : threadCounts) {
+        WorkerPool pool;
+        if (threads > 1) StartWorkerPool(pool, threads);
+        // Slices start on cache lines (the streaming kernels need 16-byte
+        // alignment); the last thread also takes the remainder
+        const size_t slice = size / threads / lineBytes * lineBytes;
+        auto sliceBytes = [&](size_t t) { return t + 1 == threads ? size - t * slice : slice; };
+        size_t copiedBytes = 0;
+        for (size_t t = 0; t < threads; ++t) copiedBytes += sliceBytes(t);
+
+        for (const DirectMode& mode : modes) {
+            if (ShouldAbortBenchmark()) break;
+            BenchmarkResult result;
+            result.testName = std::string("CPU Direct ") + mode.label + " (" + std::to_string(threads) +
+                              (threads == 1 ? " thread)" : " threads)");
+            result.unit = "GB/s";
+
+            for (int pass = 0; pass <= passes && !ShouldAbortBenchmark(); ++pass) {
+                if (!mode.write) InvalidateMappedBuffer(Bench().device, vram);
+                auto startTime = std::chrono::high_resolution_clock::now();
+                ParallelFor(pool, threads, [&](size_t t) {
+                    char* vramSlice = static_cast<char*>(vram.mappedPtr) + t * slice;
+                    char* hostSlice = static_cast<char*>(host) + t * slice;
+                    if (mode.write) mode.copy(vramSlice, hostSlice, sliceBytes(t));
+                    else mode.copy(hostSlice, vramSlice, sliceBytes(t));
+                });
+                if (mode.write) FlushMappedBuffer(Bench().device, vram);
+                double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+                if (pass == 0 || seconds <= 0) continue;  // Pass 0 warms up TLBs and the WC path
+                result.samples.push_back(static_cast<double>(copiedBytes) / (1024.0 * 1024.0 * 1024.0) / seconds);
+            }
+            if (result.samples.empty()) continue;
+
+            result.minValue = *std::min_element(result.samples.begin(), result.samples.end());
+            result.maxValue = *std::max_element(result.samples.begin(), result.samples.end());
+            result.avgValue = std::accumulate(result.samples.begin(), result.samples.end(), 0.0) / result.samples.size();
+            Log("  " + result.testName + ": " + std::to_string(result.avgValue).substr(0, 5) + " GB/s");
+            double& best = mode.write ? bestWrite : bestRead;
+            if (result.avgValue > best) {
+                best = result.avgValue;
+                (mode.write ? bestWriteName : bestReadName) = result.testName;
+            }
+            allResults.push_back(std::move(result));
+        }
+        if (threads > 1) StopWorkerPool(pool);
+    }
+
+    vram.Destroy(Bench().device);
+    free(host);
+
+    // Which upload/readback strategy wins on this box
+    auto verdict = [](const char* direction, const std::string& bestName, double best, double dma) {
+        if (bestName.empty() || dma <= 0.0) return;
+        char line[256];
+        snprintf(line, sizeof(line), "  %s: best direct %.2f GB/s (%s) vs. DMA %.2f GB/s - %s wins",
+                 direction, best, bestName.c_str(), dma, best > dma ? "CPU direct" : "DMA");
+        Log(line);
+    };
+    verdict("CPU->GPU", bestWriteName, bestWrite, dmaUpload);
+    verdict("GPU->CPU", bestReadName, bestRead, dmaDownload);
+}
+
+// ----------------------------------------------------------------------------
+// Compute-shader copies vs. DMA
+// ----------------------------------------------------------------------------
+// The transfer queue feeds the GPU's copy engines. A compute kernel can move
+// the same bytes with shader loads/stores instead ("SM copy" in nvbandwidth
+// terms), which on some GPUs keeps more PCIe requests in flight than the DMA
+// engines do. The kernel runs on its own device and compute queue (as the
+// memory latency test does), timed with GPU timestamps, across a workgroup
+// sweep that shows how much occupancy it takes to saturate the link.
+
+struct ComputeCopyEngine {
+    VkDevice              device = VK_NULL_HANDLE;
+    VkQueue               queue = VK_NULL_HANDLE;
+    uint32_t              queueFamily = UINT32_MAX;
+    VkCommandPool         commandPool = VK_NULL_HANDLE;
+    VkCommandBuffer       cmd = VK_NULL_HANDLE;
+    VkFence               fence = VK_NULL_HANDLE;
+    VkQueryPool           queryPool = VK_NULL_HANDLE;
+    VkShaderModule        shaderModule = VK_NULL_HANDLE;
+    VkDescriptorSetLayout descSetLayout = VK_NULL_HANDLE;
+    VkPipelineLayout      pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline            pipeline = VK_NULL_HANDLE;
+    VkDescriptorPool      descPool = VK_NULL_HANDLE;
+    double                timestampPeriod = 1.0;     // ns per tick
+    uint32_t              maxGroups = 0;
+    VkDeviceSize          maxRange = 0;              // maxStorageBufferRange
+};
+
+void DestroyComputeCopyEngine(ComputeCopyEngine& engine) {
+    if (engine.device == VK_NULL_HANDLE) return;
+    vkDeviceWaitIdle(engine.device);
+
+    if (engine.descPool != VK_NULL_HANDLE) vkDestroyDescriptorPool(engine.device, engine.descPool, nullptr);
+    if (engine.pipeline != VK_NULL_HANDLE) vkDestroyPipeline(engine.device, engine.pipeline, nullptr);
+    if (engine.pipelineLayout != VK_NULL_HANDLE) vkDestroyPipelineLayout(engine.device, engine.pipelineLayout, nullptr);
+    if (engine.descSetLayout != VK_NULL_HANDLE) vkDestroyDescriptorSetLayout(engine.device, engine.descSetLayout, nullptr);
+    if (engine.shaderModule != VK_NULL_HANDLE) vkDestroyShaderModule(engine.device, engine.shaderModule, nullptr);
+    if (engine.queryPool != VK_NULL_HANDLE) vkDestroyQueryPool(engine.device, engine.queryPool, nullptr);
+    if (engine.fence != VK_NULL_HANDLE) vkDestroyFence(engine.device, engine.fence, nullptr);
+    if (engine.commandPool != VK_NULL_HANDLE) vkDestroyCommandPool(engine.device, engine.commandPool, nullptr);
+    vkDestroyDevice(engine.device, nullptr);
+
+    engine = ComputeCopyEngine();
+}
+
+// Compute device (async compute family preferred), copy pipeline and a pool
+// for one descriptor set per direction. On failure the caller destroys engine.
+bool CreateComputeCopyEngine(ComputeCopyEngine& engine) {
     uint32_t queueFamilyCount = 0;
-    vkGetPhysicalDeviceQueueFamilyProperties(g_app.benchPhysicalDevice, &queueFamilyCount, nullptr);
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, nullptr);
     std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
-    vkGetPhysicalDeviceQueueFamilyProperties(g_app.benchPhysicalDevice, &queueFamilyCount, queueFamilies.data());
+    vkGetPhysicalDeviceQueueFamilyProperties(Bench().physicalDevice, &queueFamilyCount, queueFamilies.data());
 
     for (uint32_t i = 0; i < queueFamilyCount; i++) {
         bool hasCompute = (queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0;
-        bool hasTimestamps = queueFamilies[i].timestampValidBits > 0;
-        if (hasCompute && hasTimestamps) {
-            computeFamily = i;
+        bool hasGraphics = (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0;
+        if (!hasCompute || queueFamilies[i].timestampValidBits == 0) continue;
+        if (!hasGraphics) {
+            engine.queueFamily = i;
             break;
         }
+        if (engine.queueFamily == UINT32_MAX) engine.queueFamily = i;
     }
-    if (computeFamily == UINT32_MAX) {
-        Log("[WARNING] No compute-capable queue with timestamps - skipping GPU memory latency test");
-        return result;
+    if (engine.queueFamily == UINT32_MAX) {
+        Log("[WARNING] No compute-capable queue with timestamps - skipping compute copy test");
+        return false;
     }
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Creating separate compute device (family " + std::to_string(computeFamily) + ") for memory latency test");
 
-    // 2. Create a separate VkDevice with ONLY the compute queue
     float priority = 1.0f;
-    VkDeviceQueueCreateInfo computeQueueInfo = {};
-    computeQueueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    computeQueueInfo.queueFamilyIndex = computeFamily;
-    computeQueueInfo.queueCount = 1;
-    computeQueueInfo.pQueuePriorities = &priority;
+    VkDeviceQueueCreateInfo queueInfo = {};
+    queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueInfo.queueFamilyIndex = engine.queueFamily;
+    queueInfo.queueCount = 1;
+    queueInfo.pQueuePriorities = &priority;
 
     VkDeviceCreateInfo deviceInfo = {};
     deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     deviceInfo.queueCreateInfoCount = 1;
-    deviceInfo.pQueueCreateInfos = &computeQueueInfo;
-
-    VkResult vr = vkCreateDevice(g_app.benchPhysicalDevice, &deviceInfo, nullptr, &computeDevice);
-    if (vr != VK_SUCCESS) {
-        Log("[ERROR] Failed to create compute device for memory latency test: " + std::to_string((int)vr));
-        return result;
-    }
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Compute device created successfully");
-
-    vkGetDeviceQueue(computeDevice, computeFamily, 0, &computeQueue);
+    deviceInfo.pQueueCreateInfos = &queueInfo;
+    VK_CHECK_RETURN(vkCreateDevice(Bench().physicalDevice, &deviceInfo, nullptr, &engine.device), false);
+    vkGetDeviceQueue(engine.device, engine.queueFamily, 0, &engine.queue);
 
-    // 3. Create command pool and buffer on compute device
-    VkCommandPoolCreateInfo poolCreateInfo = {};
-    poolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    poolCreateInfo.queueFamilyIndex = computeFamily;
-    if (vkCreateCommandPool(computeDevice, &poolCreateInfo, nullptr, &computeCommandPool) != VK_SUCCESS) {
-        Log("[ERROR] Failed to create compute command pool");
-        vkDestroyDevice(computeDevice, nullptr);
-        return result;
-    }
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = engine.queueFamily;
+    VK_CHECK_RETURN(vkCreateCommandPool(engine.device, &poolInfo, nullptr, &engine.commandPool), false);
 
     VkCommandBufferAllocateInfo cmdAllocInfo = {};
     cmdAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    cmdAllocInfo.commandPool = computeCommandPool;
+    cmdAllocInfo.commandPool = engine.commandPool;
     cmdAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     cmdAllocInfo.commandBufferCount = 1;
-    if (vkAllocateCommandBuffers(computeDevice, &cmdAllocInfo, &computeCmdBuf) != VK_SUCCESS) {
-        Log("[ERROR] Failed to allocate compute command buffer");
-        vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
-        vkDestroyDevice(computeDevice, nullptr);
-        return result;
-    }
+    VK_CHECK_RETURN(vkAllocateCommandBuffers(engine.device, &cmdAllocInfo, &engine.cmd), false);
 
-    // ===== Now create all resources on the compute device =====
+    VkFenceCreateInfo fenceInfo = {};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    VK_CHECK_RETURN(vkCreateFence(engine.device, &fenceInfo, nullptr, &engine.fence), false);
+
+    VkQueryPoolCreateInfo queryPoolInfo = {};
+    queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    queryPoolInfo.queryCount = 2;
+    VK_CHECK_RETURN(vkCreateQueryPool(engine.device, &queryPoolInfo, nullptr, &engine.queryPool), false);
 
-    // 4. Create SPIR-V shader module
     VkShaderModuleCreateInfo shaderInfo = {};
     shaderInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    shaderInfo.codeSize = g_memoryLatencySPIRVSize;
-    shaderInfo.pCode = g_memoryLatencySPIRV;
-
-    VkShaderModule shaderModule = VK_NULL_HANDLE;
-    vr = vkCreateShaderModule(computeDevice, &shaderInfo, nullptr, &shaderModule);
-    if (vr != VK_SUCCESS) {
-        Log("[ERROR] Failed to create memory latency shader module: " + std::to_string((int)vr));
-        vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
-        vkDestroyDevice(computeDevice, nullptr);
-        return result;
+    shaderInfo.codeSize = g_computeCopySPIRVSize;
+    shaderInfo.pCode = g_computeCopySPIRV;
+    VK_CHECK_RETURN(vkCreateShaderModule(engine.device, &shaderInfo, nullptr, &engine.shaderModule), false);
+
+    // binding 0: source, binding 1: destination
+    VkDescriptorSetLayoutBinding bindings[2] = {};
+    for (uint32_t i = 0; i < 2; ++i) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
     }
-
-    // 5. Create descriptor set layout
-    VkDescriptorSetLayoutBinding storageBinding = {};
-    storageBinding.binding = 0;
-    storageBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    storageBinding.descriptorCount = 1;
-    storageBinding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
-
     VkDescriptorSetLayoutCreateInfo layoutInfo = {};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    layoutInfo.bindingCount = 1;
-    layoutInfo.pBindings = &storageBinding;
-
-    VkDescriptorSetLayout descSetLayout = VK_NULL_HANDLE;
-    vkCreateDescriptorSetLayout(computeDevice, &layoutInfo, nullptr, &descSetLayout);
+    layoutInfo.bindingCount = 2;
+    layoutInfo.pBindings = bindings;
+    VK_CHECK_RETURN(vkCreateDescriptorSetLayout(engine.device, &layoutInfo, nullptr, &engine.descSetLayout), false);
 
-    // 6. Create pipeline layout with push constants
     VkPushConstantRange pushRange = {};
     pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
     pushRange.offset = 0;
-    pushRange.size = 8;  // 2 x uint32: numChases, startIndex
+    pushRange.size = sizeof(uint32_t);
 
     VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutInfo.setLayoutCount = 1;
-    pipelineLayoutInfo.pSetLayouts = &descSetLayout;
+    pipelineLayoutInfo.pSetLayouts = &engine.descSetLayout;
     pipelineLayoutInfo.pushConstantRangeCount = 1;
     pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+    VK_CHECK_RETURN(vkCreatePipelineLayout(engine.device, &pipelineLayoutInfo, nullptr, &engine.pipelineLayout), false);
 
-    VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
-    vkCreatePipelineLayout(computeDevice, &pipelineLayoutInfo, nullptr, &pipelineLayout);
+    VkComputePipelineCreateInfo pipelineInfo = {};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = engine.shaderModule;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.layout = engine.pipelineLayout;
+    VK_CHECK_RETURN(vkCreateComputePipelines(engine.device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &engine.pipeline), false);
 
-    // 7. Create compute pipeline
-    VkComputePipelineCreateInfo pipelineCreateInfo = {};
-    pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
-    pipelineCreateInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    pipelineCreateInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    pipelineCreateInfo.stage.module = shaderModule;
-    pipelineCreateInfo.stage.pName = "main";
-    pipelineCreateInfo.layout = pipelineLayout;
+    VkDescriptorPoolSize descPoolSize = {};
+    descPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descPoolSize.descriptorCount = 2 * 3;
 
-    VkPipeline pipeline = VK_NULL_HANDLE;
-    vr = vkCreateComputePipelines(computeDevice, VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pipeline);
-    if (vr != VK_SUCCESS) {
-        Log("[ERROR] Failed to create compute pipeline: " + std::to_string((int)vr));
-        vkDestroyShaderModule(computeDevice, shaderModule, nullptr);
-        vkDestroyPipelineLayout(computeDevice, pipelineLayout, nullptr);
-        vkDestroyDescriptorSetLayout(computeDevice, descSetLayout, nullptr);
-        vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
-        vkDestroyDevice(computeDevice, nullptr);
-        return result;
+    VkDescriptorPoolCreateInfo descPoolInfo = {};
+    descPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descPoolInfo.maxSets = 3;
+    descPoolInfo.poolSizeCount = 1;
+    descPoolInfo.pPoolSizes = &descPoolSize;
+    VK_CHECK_RETURN(vkCreateDescriptorPool(engine.device, &descPoolInfo, nullptr, &engine.descPool), false);
+
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(Bench().physicalDevice, &props);
+    engine.timestampPeriod = props.limits.timestampPeriod;
+    engine.maxGroups = std::min(props.limits.maxComputeWorkGroupCount[0], Constants::COMPUTE_COPY_MAX_GROUPS);
+    engine.maxRange = props.limits.maxStorageBufferRange;
+    return true;
+}
+
+// Descriptor set binding src -> dst
+VkDescriptorSet AllocateComputeCopySet(ComputeCopyEngine& engine, const VkBufferAllocation& src,
+                                       const VkBufferAllocation& dst) {
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    VkDescriptorSetAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = engine.descPool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &engine.descSetLayout;
+    VK_CHECK_RETURN(vkAllocateDescriptorSets(engine.device, &allocInfo, &set), VK_NULL_HANDLE);
+
+    VkDescriptorBufferInfo bufferInfos[2] = {};
+    bufferInfos[0].buffer = src.buffer;
+    bufferInfos[0].range = src.size;
+    bufferInfos[1].buffer = dst.buffer;
+    bufferInfos[1].range = dst.size;
+    VkWriteDescriptorSet writes[2] = {};
+    for (uint32_t i = 0; i < 2; ++i) {
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = set;
+        writes[i].dstBinding = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].pBufferInfo = &bufferInfos[i];
+    }
+    vkUpdateDescriptorSets(engine.device, 2, writes, 0, nullptr);
+    return set;
+}
+
+// Average GB/s of `passes` timestamped dispatches copying size bytes through set
+double TimeComputeCopy(ComputeCopyEngine& engine, VkDescriptorSet set, VkDeviceSize size, uint32_t groups, int passes) {
+    const uint32_t count = static_cast<uint32_t>(size / 16);  // uvec4 elements
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(engine.cmd, &beginInfo);
+    vkCmdResetQueryPool(engine.cmd, engine.queryPool, 0, 2);
+    vkCmdBindPipeline(engine.cmd, VK_PIPELINE_BIND_POINT_COMPUTE, engine.pipeline);
+    vkCmdBindDescriptorSets(engine.cmd, VK_PIPELINE_BIND_POINT_COMPUTE, engine.pipelineLayout, 0, 1, &set, 0, nullptr);
+    vkCmdPushConstants(engine.cmd, engine.pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(count), &count);
+    vkCmdWriteTimestamp(engine.cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, engine.queryPool, 0);
+    vkCmdDispatch(engine.cmd, groups, 1, 1);
+    vkCmdWriteTimestamp(engine.cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, engine.queryPool, 1);
+    vkEndCommandBuffer(engine.cmd);
+
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &engine.cmd;
+
+    std::vector<double> bandwidths;
+    for (int pass = 0; pass <= passes && !ShouldAbortBenchmark(); ++pass) {
+        vkResetFences(engine.device, 1, &engine.fence);
+        if (vkQueueSubmit(engine.queue, 1, &submitInfo, engine.fence) != VK_SUCCESS ||
+            vkWaitForFences(engine.device, 1, &engine.fence, VK_TRUE, Constants::FENCE_WAIT_TIMEOUT_MS * 1000000ULL) != VK_SUCCESS) {
+            Log("[ERROR] Compute copy dispatch failed or timed out");
+            break;
+        }
+        uint64_t timestamps[2] = {};
+        VkResult qr = vkGetQueryPoolResults(engine.device, engine.queryPool, 0, 2, sizeof(timestamps), timestamps,
+                                            sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        if (pass == 0 || qr != VK_SUCCESS || timestamps[1] <= timestamps[0]) continue;  // Pass 0 warms up
+        double seconds = static_cast<double>(timestamps[1] - timestamps[0]) * engine.timestampPeriod / 1e9;
+        bandwidths.push_back(static_cast<double>(size) / (1024.0 * 1024.0 * 1024.0) / seconds);
     }
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Compute pipeline created successfully");
+    return bandwidths.empty() ? 0.0 : std::accumulate(bandwidths.begin(), bandwidths.end(), 0.0) / bandwidths.size();
+}
 
-    // 8. Generate chain data
-    const size_t numElements = Constants::MEMORY_LATENCY_BUFFER_SIZE / sizeof(uint32_t);
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Generating pointer-chase chain (" + std::to_string(numElements) +
-            " elements, " + FormatSize(Constants::MEMORY_LATENCY_BUFFER_SIZE) + ")");
-    auto chainData = GeneratePointerChaseChain(numElements);
+// First workgroup count reaching COMPUTE_COPY_SATURATION of the best bandwidth (0 if none)
+uint32_t SaturatingGroupCount(const std::vector<ComputeCopyPoint>& points, double ComputeCopyPoint::*direction) {
+    double best = 0.0;
+    for (const auto& p : points) best = std::max(best, p.*direction);
+    if (best <= 0.0) return 0;
+    for (const auto& p : points) {
+        if (p.*direction >= best * Constants::COMPUTE_COPY_SATURATION) return p.groups;
+    }
+    return 0;
+}
+
+// Host->VRAM, VRAM->host and VRAM->VRAM through the copy kernel, next to the
+// DMA averages of the regular runs and a DMA VRAM->VRAM copy on the bench queue
+void RunComputeCopyTest(double dmaUpload, double dmaDownload, std::vector<BenchmarkResult>& allResults) {
+    SetCurrentTest("Compute Copy");
+    ComputeCopyResult copyResult;
+    copyResult.dmaUpload = dmaUpload;
+    copyResult.dmaDownload = dmaDownload;
+
+    ComputeCopyEngine engine;
+    if (!CreateComputeCopyEngine(engine)) {
+        DestroyComputeCopyEngine(engine);
+        return;
+    }
+
+    const size_t size = std::min<size_t>(g_app.config.bandwidthSize, engine.maxRange) & ~static_cast<size_t>(0xFFFF);
+    Log("--- Compute copy vs. DMA: " + FormatSize(size) + " on queue family " + std::to_string(engine.queueFamily) + " ---");
+
+    // DMA reference for VRAM->VRAM on the bench transfer queue
+    {
+        auto dmaSrc = CreateBuffer(VkBufferType::DeviceLocal, size);
+        auto dmaDst = CreateBuffer(VkBufferType::DeviceLocal, size);
+        if (dmaSrc && dmaDst) {
+            auto resDma = RunBandwidthTest("GPU->GPU " + FormatSize(size) + " (DMA)", dmaSrc, dmaDst, size,
+                                           g_app.config.copiesPerBatch, g_app.config.bandwidthBatches);
+            if (!resDma.samples.empty()) {
+                copyResult.dmaDeviceCopy = resDma.avgValue;
+                allResults.push_back(resDma);
+            }
+        }
+        dmaSrc.Destroy(Bench().device);
+        dmaDst.Destroy(Bench().device);
+        SetCurrentTest("Compute Copy");
+    }
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    auto hostSrc = CreateComputeDeviceBuffer(engine.device, size, usage,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    auto hostDst = CreateComputeDeviceBuffer(engine.device, size, usage,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+    if (!hostDst) {
+        hostDst = CreateComputeDeviceBuffer(engine.device, size, usage,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
+    auto vramA = CreateComputeDeviceBuffer(engine.device, size, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    auto vramB = CreateComputeDeviceBuffer(engine.device, size, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    if (hostSrc && hostDst && vramA && vramB) {
+        memset(hostSrc.mappedPtr, 0x5A, size);
+        VkDescriptorSet uploadSet = AllocateComputeCopySet(engine, hostSrc, vramA);
+        VkDescriptorSet downloadSet = AllocateComputeCopySet(engine, vramA, hostDst);
+        VkDescriptorSet deviceSet = AllocateComputeCopySet(engine, vramA, vramB);
+
+        std::vector<uint32_t> groupCounts;
+        if (g_app.config.computeCopyGroups > 0) {
+            groupCounts.push_back(std::min<uint32_t>(g_app.config.computeCopyGroups, engine.maxGroups));
+        } else {
+            for (uint32_t groups = 1; groups <= engine.maxGroups; groups *= 4) groupCounts.push_back(groups);
+        }
+
+        const int passes = std::min(g_app.config.bandwidthBatches, Constants::COMPUTE_COPY_MAX_PASSES);
+        for (uint32_t groups : groupCounts) {
+            if (ShouldAbortBenchmark() || !uploadSet || !downloadSet || !deviceSet) break;
+            ComputeCopyPoint point;
+            point.groups = groups;
+            point.upload = TimeComputeCopy(engine, uploadSet, size, groups, passes);
+            point.download = TimeComputeCopy(engine, downloadSet, size, groups, passes);
+            point.deviceCopy = TimeComputeCopy(engine, deviceSet, size, groups, passes);
+            copyResult.points.push_back(point);
+
+            char line[160];
+            snprintf(line, sizeof(line), "  %5u groups (%7u threads): CPU->GPU %6.2f, GPU->CPU %6.2f, GPU->GPU %7.2f GB/s",
+                     groups, groups * Constants::COMPUTE_COPY_WORKGROUP, point.upload, point.download, point.deviceCopy);
+            Log(line);
+        }
+    } else {
+        Log("[ERROR] Failed to allocate compute copy buffers");
+    }
+
+    hostSrc.Destroy(engine.device);
+    hostDst.Destroy(engine.device);
+    vramA.Destroy(engine.device);
+    vramB.Destroy(engine.device);
+    DestroyComputeCopyEngine(engine);
+    if (copyResult.empty()) return;
+
+    // Best point per direction as a regular result, next to the DMA entries
+    struct Direction {
+        const char* name;
+        double ComputeCopyPoint::*value;
+        double dma;
+    };
+    const Direction directions[] = {
+        { "CPU->GPU", &ComputeCopyPoint::upload, copyResult.dmaUpload },
+        { "GPU->CPU", &ComputeCopyPoint::download, copyResult.dmaDownload },
+        { "GPU->GPU", &ComputeCopyPoint::deviceCopy, copyResult.dmaDeviceCopy },
+    };
+    for (const auto& d : directions) {
+        const ComputeCopyPoint* best = &copyResult.points.front();
+        for (const auto& p : copyResult.points) {
+            if (p.*d.value > best->*d.value) best = &p;
+        }
+        if (best->*d.value <= 0.0) continue;
+
+        BenchmarkResult result;
+        result.testName = std::string(d.name) + " " + FormatSize(size) + " (compute, " + std::to_string(best->groups) + " groups)";
+        result.unit = "GB/s";
+        result.samples.push_back(best->*d.value);
+        result.minValue = result.maxValue = result.avgValue = best->*d.value;
+        allResults.push_back(result);
+
+        char line[192];
+        snprintf(line, sizeof(line), "  %s: compute %.2f GB/s (saturates at %u groups) vs. DMA %.2f GB/s - %s wins",
+                 d.name, best->*d.value, SaturatingGroupCount(copyResult.points, d.value), d.dma,
+                 best->*d.value > d.dma ? "compute" : "DMA");
+        Log(line);
+    }
+
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.computeCopy = std::move(copyResult);
+}
+
+// ----------------------------------------------------------------------------
+// Scatter/gather copies
+// ----------------------------------------------------------------------------
+// Real uploads are mostly many small sub-buffer updates. Every VkBufferCopy
+// region becomes a DMA descriptor, and every vkCmdCopyBuffer adds command
+// processing on top, so a batch of N regions is timed both as one command
+// with N regions and as N single-region commands. Staging memory is packed;
+// the VRAM side is spread out by the stride and optionally shuffled.
+
+// Times `batches` submissions of the recorded region copies with GPU
+// timestamps (CPU wall time without them). Samples are GB/s of payload;
+// avgSeconds receives the mean batch time.
+BenchmarkResult RunRegionCopyTest(const std::string& name, VkBuffer src, VkBuffer dst,
+                                  const std::vector<VkBufferCopy>& regions, bool singleCommand,
+                                  int batches, double& avgSeconds) {
+    SetCurrentTest(name);
+    BenchmarkResult result;
+    result.testName = name;
+    result.unit = "GB/s";
+    avgSeconds = 0.0;
+
+    VkQueryPool queryPool = VK_NULL_HANDLE;
+    if (Bench().timestampPeriod != 0) {
+        VkQueryPoolCreateInfo queryPoolInfo = {};
+        queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolInfo.queryCount = 2;
+        if (vkCreateQueryPool(Bench().device, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
+            Log("[ERROR] Failed to create timestamp query pool in scatter test");
+            return result;
+        }
+    }
+
+    // Recorded once: [query reset, copies]
+    std::vector<VkCommandBuffer> cmds = AllocateBenchCommandBuffers(2);
+    if (cmds.empty()) {
+        if (queryPool != VK_NULL_HANDLE) vkDestroyQueryPool(Bench().device, queryPool, nullptr);
+        return result;
+    }
+    BeginReusableCommandBuffer(cmds[0]);
+    if (queryPool != VK_NULL_HANDLE) vkCmdResetQueryPool(cmds[0], queryPool, 0, 2);
+    vkEndCommandBuffer(cmds[0]);
 
-    // 9. Create chain buffer (device-local, storage buffer)
-    VkBufferAllocation chainBuffer = {};
-    {
-        VkBufferCreateInfo bufInfo = {};
-        bufInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufInfo.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
-        bufInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-        bufInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    BeginReusableCommandBuffer(cmds[1]);
+    if (queryPool != VK_NULL_HANDLE) vkCmdWriteTimestamp(cmds[1], VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, 0);
+    if (singleCommand) {
+        vkCmdCopyBuffer(cmds[1], src, dst, static_cast<uint32_t>(regions.size()), regions.data());
+    } else {
+        for (const auto& region : regions) vkCmdCopyBuffer(cmds[1], src, dst, 1, &region);
+    }
+    if (queryPool != VK_NULL_HANDLE) vkCmdWriteTimestamp(cmds[1], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, 1);
+    vkEndCommandBuffer(cmds[1]);
 
-        vkCreateBuffer(computeDevice, &bufInfo, nullptr, &chainBuffer.buffer);
+    double payloadGB = 0.0;
+    for (const auto& region : regions) payloadGB += static_cast<double>(region.size);
+    payloadGB /= 1024.0 * 1024.0 * 1024.0;
 
-        VkMemoryRequirements memReqs;
-        vkGetBufferMemoryRequirements(computeDevice, chainBuffer.buffer, &memReqs);
+    std::vector<double> bandwidths, seconds;
+    SubmitAndWait(cmds.data(), 2);  // Warm-up
+    for (int i = 0; i < batches && !ShouldAbortBenchmark(); ++i) {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        FenceWaitResult fenceResult = SubmitAndWait(cmds.data(), 2);
+        auto endTime = std::chrono::high_resolution_clock::now();
+        if (fenceResult != FenceWaitResult::Success) break;
 
-        uint32_t memType = FindMemoryType(g_app.benchPhysicalDevice, memReqs.memoryTypeBits,
-            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        double batchSeconds = std::chrono::duration<double>(endTime - startTime).count();
+        if (queryPool != VK_NULL_HANDLE) {
+            uint64_t timestamps[2] = {};
+            VkResult qr = vkGetQueryPoolResults(Bench().device, queryPool, 0, 2, sizeof(timestamps), timestamps,
+                                                sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+            if (qr != VK_SUCCESS || timestamps[1] <= timestamps[0]) continue;
+            batchSeconds = static_cast<double>(timestamps[1] - timestamps[0]) *
+                           static_cast<double>(Bench().timestampPeriod) / 1e9;
+        }
+        if (batchSeconds <= 0) continue;
+        seconds.push_back(batchSeconds);
+        bandwidths.push_back(payloadGB / batchSeconds);
+        g_app.progress = static_cast<float>(i + 1) / static_cast<float>(batches);
+    }
+    FreeBenchCommandBuffers(cmds);
+    if (queryPool != VK_NULL_HANDLE) vkDestroyQueryPool(Bench().device, queryPool, nullptr);
 
-        VkMemoryAllocateInfo allocInfo = {};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memReqs.size;
-        allocInfo.memoryTypeIndex = memType;
-        vkAllocateMemory(computeDevice, &allocInfo, nullptr, &chainBuffer.memory);
-        vkBindBufferMemory(computeDevice, chainBuffer.buffer, chainBuffer.memory, 0);
-        chainBuffer.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
+    if (!bandwidths.empty()) {
+        avgSeconds = std::accumulate(seconds.begin(), seconds.end(), 0.0) / seconds.size();
+        std::sort(bandwidths.begin(), bandwidths.end());
+        result.minValue = bandwidths.front();
+        result.maxValue = bandwidths.back();
+        result.avgValue = std::accumulate(bandwidths.begin(), bandwidths.end(), 0.0) / bandwidths.size();
+        result.samples = std::move(bandwidths);
+    } else {
+        Log("[WARNING] No valid samples collected for " + name);
     }
+    return result;
+}
 
-    // 10. Create staging buffer and upload chain data
-    VkBufferAllocation stagingBuffer = {};
-    {
-        VkBufferCreateInfo bufInfo = {};
-        bufInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufInfo.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
-        bufInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        bufInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+// CPU->GPU gathers packed staging data into scattered VRAM regions, GPU->CPU
+// collects them back into packed host memory
+void RunScatterCopyTest(std::vector<BenchmarkResult>& allResults) {
+    SetCurrentTest("Scatter/Gather Copies");
+    ScatterCopyResult scatter;
+    scatter.regionSize = static_cast<size_t>(g_app.config.scatterRegionSize);
+    scatter.stride = std::max<size_t>(g_app.config.scatterStride, scatter.regionSize);
+    scatter.random = g_app.config.scatterRandom;
+
+    // The VRAM span has to fit alongside everything else the bench allocates
+    const size_t maxSpan = GetSafeMaxBandwidthSize(g_app.config.selectedGPU);
+    scatter.regionCount = static_cast<int>(std::min<size_t>(g_app.config.scatterRegions, maxSpan / scatter.stride));
+    if (scatter.regionCount < g_app.config.scatterRegions) {
+        Log("[WARNING] Scatter test limited to " + std::to_string(scatter.regionCount) + " regions (" +
+            FormatSize(maxSpan) + " of VRAM)");
+    }
+    if (scatter.regionCount == 0) return;
+
+    const size_t packedSize = scatter.regionSize * scatter.regionCount;
+    const size_t spanSize = scatter.stride * scatter.regionCount;
+    const std::string shape = std::to_string(scatter.regionCount) + "x" + FormatSize(scatter.regionSize) +
+                              (scatter.random ? " random" : "");
+    Log("--- Scatter/gather copies: " + shape + ", stride " + FormatSize(scatter.stride) + " ---");
+
+    std::vector<size_t> slots(scatter.regionCount);
+    std::iota(slots.begin(), slots.end(), size_t(0));
+    if (scatter.random) {
+        std::mt19937 rng(42);  // Fixed seed for reproducibility
+        std::shuffle(slots.begin(), slots.end(), rng);
+    }
+    std::vector<VkBufferCopy> uploadRegions(scatter.regionCount), downloadRegions(scatter.regionCount);
+    for (int i = 0; i < scatter.regionCount; ++i) {
+        uploadRegions[i].srcOffset = i * scatter.regionSize;
+        uploadRegions[i].dstOffset = slots[i] * scatter.stride;
+        uploadRegions[i].size = scatter.regionSize;
+        downloadRegions[i].srcOffset = uploadRegions[i].dstOffset;
+        downloadRegions[i].dstOffset = uploadRegions[i].srcOffset;
+        downloadRegions[i].size = scatter.regionSize;
+    }
+
+    auto gpuBuffer = CreateBuffer(VkBufferType::DeviceLocal, spanSize);
+    auto cpuUpload = CreateBuffer(VkBufferType::Upload, packedSize);
+    auto cpuReadback = CreateBuffer(VkBufferType::Readback, packedSize);
+    if (gpuBuffer && cpuUpload && cpuReadback) {
+        const int batches = std::min(g_app.config.bandwidthBatches, Constants::SCATTER_MAX_BATCHES);
+        struct Variant {
+            const char*               label;
+            const VkBufferAllocation* src;
+            const VkBufferAllocation* dst;
+            const std::vector<VkBufferCopy>* regions;
+            bool                      singleCommand;
+            ScatterCopyTiming*        timing;
+        };
+        const std::string commands = std::to_string(scatter.regionCount) + " cmds";
+        const Variant variants[] = {
+            { "CPU->GPU", &cpuUpload, &gpuBuffer, &uploadRegions, true, &scatter.uploadBatched },
+            { "CPU->GPU", &cpuUpload, &gpuBuffer, &uploadRegions, false, &scatter.uploadSeparate },
+            { "GPU->CPU", &gpuBuffer, &cpuReadback, &downloadRegions, true, &scatter.downloadBatched },
+            { "GPU->CPU", &gpuBuffer, &cpuReadback, &downloadRegions, false, &scatter.downloadSeparate },
+        };
+        for (const auto& v : variants) {
+            if (ShouldAbortBenchmark()) break;
+            double avgSeconds = 0.0;
+            auto res = RunRegionCopyTest(std::string("Scatter ") + v.label + " " + shape +
+                                         (v.singleCommand ? " (1 cmd)" : " (" + commands + ")"),
+                                         v.src->buffer, v.dst->buffer, *v.regions, v.singleCommand, batches, avgSeconds);
+            if (res.samples.empty()) continue;
+            v.timing->bandwidth = res.avgValue;
+            v.timing->perRegionUs = avgSeconds * 1e6 / scatter.regionCount;
+            allResults.push_back(res);
+
+            char line[160];
+            snprintf(line, sizeof(line), "  %s %-12s %7.2f GB/s, %8.3f us per region", v.label,
+                     v.singleCommand ? "1 cmd:" : (commands + ":").c_str(), v.timing->bandwidth, v.timing->perRegionUs);
+            Log(line);
+        }
+
+        // Only directions where both variants produced a timing; a failed or
+        // aborted variant would otherwise show up as a bogus overhead
+        std::string overheads;
+        auto addOverhead = [&](const char* label, const ScatterCopyTiming& batched, const ScatterCopyTiming& separate) {
+            if (batched.perRegionUs <= 0 || separate.perRegionUs <= 0) return;
+            char part[64];
+            snprintf(part, sizeof(part), "%s%s %.0f ns", overheads.empty() ? "" : ", ", label,
+                     (separate.perRegionUs - batched.perRegionUs) * 1000.0);
+            overheads += part;
+        };
+        addOverhead("CPU->GPU", scatter.uploadBatched, scatter.uploadSeparate);
+        addOverhead("GPU->CPU", scatter.downloadBatched, scatter.downloadSeparate);
+        if (!overheads.empty()) Log("  Command overhead per region: " + overheads);
+    } else {
+        Log("[ERROR] Failed to allocate scatter/gather buffers");
+    }
+    gpuBuffer.Destroy(Bench().device);
+    cpuUpload.Destroy(Bench().device);
+    cpuReadback.Destroy(Bench().device);
 
-        vkCreateBuffer(computeDevice, &bufInfo, nullptr, &stagingBuffer.buffer);
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.scatterCopy = scatter;
+}
 
-        VkMemoryRequirements memReqs;
-        vkGetBufferMemoryRequirements(computeDevice, stagingBuffer.buffer, &memReqs);
+// ----------------------------------------------------------------------------
+// Buffer <-> image copies
+// ----------------------------------------------------------------------------
+// Texture streaming goes through vkCmdCopyBufferToImage / vkCmdCopyImageToBuffer,
+// where the copy engine also (de)swizzles into the image's tiling. The same
+// timestamped ring as the buffer tests times every format x tiling x layout
+// combination the device supports, so the gap to the buffer copy results is
+// the cost of the image path itself.
 
-        uint32_t memType = FindMemoryType(g_app.benchPhysicalDevice, memReqs.memoryTypeBits,
-            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+struct ImageCopyFormat {
+    const char* name;
+    VkFormat    format;
+    uint32_t    blockDim;    // Texels per block side (4 for BC)
+    uint32_t    blockBytes;
+};
 
-        VkMemoryAllocateInfo allocInfo = {};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memReqs.size;
-        allocInfo.memoryTypeIndex = memType;
-        vkAllocateMemory(computeDevice, &allocInfo, nullptr, &stagingBuffer.memory);
-        vkBindBufferMemory(computeDevice, stagingBuffer.buffer, stagingBuffer.memory, 0);
-        stagingBuffer.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
+static const ImageCopyFormat g_imageCopyFormats[] = {
+    { "RGBA8", VK_FORMAT_R8G8B8A8_UNORM,  1, 4 },
+    { "BC7",   VK_FORMAT_BC7_UNORM_BLOCK, 4, 16 },
+    { "R16F",  VK_FORMAT_R16_SFLOAT,      1, 2 },
+    { "R32F",  VK_FORMAT_R32_SFLOAT,      1, 4 },
+};
+
+// Device-local (where the memory types allow it) 2D image usable as copy
+// source and destination. Returns an invalid allocation on failure.
+VkImageAllocation CreateBenchImage(VkFormat format, VkImageTiling tiling, uint32_t extent,
+                                   uint32_t mipLevels, uint32_t arrayLayers) {
+    VkImageAllocation alloc;
+
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = format;
+    imageInfo.extent = { extent, extent, 1 };
+    imageInfo.mipLevels = mipLevels;
+    imageInfo.arrayLayers = arrayLayers;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = tiling;
+    imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VK_CHECK_RETURN(vkCreateImage(Bench().device, &imageInfo, nullptr, &alloc.image), alloc);
 
-        void* mapped = nullptr;
-        vkMapMemory(computeDevice, stagingBuffer.memory, 0, stagingBuffer.size, 0, &mapped);
-        memcpy(mapped, chainData.data(), Constants::MEMORY_LATENCY_BUFFER_SIZE);
-        vkUnmapMemory(computeDevice, stagingBuffer.memory);
+    VkMemoryRequirements memReqs;
+    vkGetImageMemoryRequirements(Bench().device, alloc.image, &memReqs);
+    uint32_t memTypeIndex = FindMemoryType(Bench().physicalDevice, memReqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    if (memTypeIndex == UINT32_MAX) memTypeIndex = FindMemoryType(Bench().physicalDevice, memReqs.memoryTypeBits, 0);
+
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = memReqs.size;
+    allocInfo.memoryTypeIndex = memTypeIndex;
+    if (memTypeIndex == UINT32_MAX ||
+        vkAllocateMemory(Bench().device, &allocInfo, nullptr, &alloc.memory) != VK_SUCCESS ||
+        vkBindImageMemory(Bench().device, alloc.image, alloc.memory, 0) != VK_SUCCESS) {
+        Log("[ERROR] Failed to allocate image memory (" + FormatSize(memReqs.size) + ")");
+        alloc.Destroy(Bench().device);
     }
+    return alloc;
+}
 
-    // Upload chain data via compute queue (compute families implicitly support transfer)
-    {
-        VkCommandBufferBeginInfo beginInfo = {};
-        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        vkBeginCommandBuffer(computeCmdBuf, &beginInfo);
+// One-shot layout transition of every subresource on the bench queue
+bool TransitionBenchImage(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout) {
+    BeginBenchCommandBuffer();
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ? VkAccessFlags(0) : VkAccessFlags(VK_ACCESS_TRANSFER_WRITE_BIT);
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = oldLayout;
+    barrier.newLayout = newLayout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS };
+    vkCmdPipelineBarrier(Bench().commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
+    return EndAndSubmitBenchCommandBuffer() == FenceWaitResult::Success;
+}
 
-        VkBufferCopy copyRegion = {};
-        copyRegion.size = Constants::MEMORY_LATENCY_BUFFER_SIZE;
-        vkCmdCopyBuffer(computeCmdBuf, stagingBuffer.buffer, chainBuffer.buffer, 1, &copyRegion);
+// Tightly packed buffer regions for every mip level (all layers at once).
+// Returns the total byte size.
+size_t PlanImageCopyRegions(const ImageCopyFormat& fmt, uint32_t extent, uint32_t mipLevels, uint32_t arrayLayers,
+                            std::vector<VkBufferImageCopy>& regions) {
+    size_t offset = 0;
+    for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+        const uint32_t side = std::max(extent >> mip, 1u);
+        const size_t blocks = (side + fmt.blockDim - 1) / fmt.blockDim;
+
+        VkBufferImageCopy region = {};
+        region.bufferOffset = offset;
+        region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, mip, 0, arrayLayers };
+        region.imageExtent = { side, side, 1 };
+        regions.push_back(region);
+
+        offset += blocks * blocks * fmt.blockBytes * arrayLayers;
+        offset = (offset + 15) & ~static_cast<size_t>(15);  // Offsets stay texel-block and 4-byte aligned
+    }
+    return offset;
+}
 
-        // Barrier: transfer write -> shader read (same queue family, no ownership transfer)
-        VkBufferMemoryBarrier barrier = {};
-        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.buffer = chainBuffer.buffer;
-        barrier.offset = 0;
-        barrier.size = VK_WHOLE_SIZE;
-        vkCmdPipelineBarrier(computeCmdBuf,
-            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
-            0, 0, nullptr, 1, &barrier, 0, nullptr);
+// Every supported format x tiling x layout: buffer -> image, then image -> buffer
+void RunImageCopyTest(double bufferUpload, double bufferDownload, std::vector<BenchmarkResult>& allResults) {
+    SetCurrentTest("Image Copies");
+    ImageCopyResult imageResult;
+    imageResult.bufferUpload = bufferUpload;
+    imageResult.bufferDownload = bufferDownload;
 
-        vkEndCommandBuffer(computeCmdBuf);
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(Bench().physicalDevice, &props);
 
-        VkFence uploadFence = VK_NULL_HANDLE;
-        VkFenceCreateInfo fenceCI = {};
-        fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        vkCreateFence(computeDevice, &fenceCI, nullptr, &uploadFence);
+    // Largest power-of-two side whose RGBA8 level 0 fits the bandwidth test size
+    uint32_t extent = std::min(Constants::IMAGE_COPY_MAX_EXTENT, props.limits.maxImageDimension2D);
+    while (extent > 64 && static_cast<size_t>(extent) * extent * 4 > g_app.config.bandwidthSize) extent /= 2;
 
-        VkSubmitInfo submitInfo = {};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &computeCmdBuf;
-        vkQueueSubmit(computeQueue, 1, &submitInfo, uploadFence);
-        vkWaitForFences(computeDevice, 1, &uploadFence, VK_TRUE, UINT64_MAX);
-        vkDestroyFence(computeDevice, uploadFence, nullptr);
-    }
+    struct Layout {
+        const char* name;
+        uint32_t    extent, mipLevels, arrayLayers;
+    };
+    const Layout layouts[] = {
+        { "2D",    extent, 1, 1 },
+        { "mips",  extent, static_cast<uint32_t>(std::log2(extent)) + 1, 1 },
+        { "array", extent / 4, 1, Constants::IMAGE_COPY_ARRAY_LAYERS },
+    };
+    const VkImageTiling tilings[] = { VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_TILING_LINEAR };
+    const int copies = g_app.config.copiesPerBatch;
+    const int batches = std::min(g_app.config.bandwidthBatches, Constants::IMAGE_COPY_MAX_BATCHES);
 
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Chain data uploaded successfully (" + FormatSize(Constants::MEMORY_LATENCY_BUFFER_SIZE) + ")");
+    Log("--- Buffer <-> image copies: " + std::to_string(extent) + "x" + std::to_string(extent) + " base level ---");
+    if (Bench().timestampPeriod == 0) {
+        Log("[WARNING] GPU timestamps not supported - skipping image copy test");
+        return;
+    }
 
-    // Free staging buffer
-    stagingBuffer.Destroy(computeDevice);
+    for (const auto& fmt : g_imageCopyFormats) {
+        VkFormatProperties formatProps;
+        vkGetPhysicalDeviceFormatProperties(Bench().physicalDevice, fmt.format, &formatProps);
 
-    // 11. Create descriptor pool and set
-    VkDescriptorPoolSize descPoolSize = {};
-    descPoolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    descPoolSize.descriptorCount = 1;
+        for (VkImageTiling tiling : tilings) {
+            const bool linear = tiling == VK_IMAGE_TILING_LINEAR;
+            const VkFormatFeatureFlags features = linear ? formatProps.linearTilingFeatures : formatProps.optimalTilingFeatures;
+            const VkFormatFeatureFlags needed = VK_FORMAT_FEATURE_TRANSFER_SRC_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
 
-    VkDescriptorPoolCreateInfo descPoolInfo = {};
-    descPoolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    descPoolInfo.maxSets = 1;
-    descPoolInfo.poolSizeCount = 1;
-    descPoolInfo.pPoolSizes = &descPoolSize;
+            for (const auto& layout : layouts) {
+                if (ShouldAbortBenchmark()) break;
+                const std::string label = std::string(fmt.name) + (linear ? " linear " : " optimal ") + layout.name;
 
-    VkDescriptorPool descPool = VK_NULL_HANDLE;
-    vkCreateDescriptorPool(computeDevice, &descPoolInfo, nullptr, &descPool);
+                VkImageFormatProperties limits = {};
+                VkResult supported = (features & needed) != needed ? VK_ERROR_FORMAT_NOT_SUPPORTED :
+                    vkGetPhysicalDeviceImageFormatProperties(Bench().physicalDevice, fmt.format, VK_IMAGE_TYPE_2D, tiling,
+                        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, 0, &limits);
+                if (supported != VK_SUCCESS || limits.maxMipLevels < layout.mipLevels ||
+                    limits.maxArrayLayers < layout.arrayLayers || limits.maxExtent.width < layout.extent) {
+                    Log("  " + label + ": not supported");
+                    continue;
+                }
 
-    VkDescriptorSetAllocateInfo descAllocInfo = {};
-    descAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    descAllocInfo.descriptorPool = descPool;
-    descAllocInfo.descriptorSetCount = 1;
-    descAllocInfo.pSetLayouts = &descSetLayout;
+                std::vector<VkBufferImageCopy> regions;
+                const size_t bytes = PlanImageCopyRegions(fmt, layout.extent, layout.mipLevels, layout.arrayLayers, regions);
+                auto image = CreateBenchImage(fmt.format, tiling, layout.extent, layout.mipLevels, layout.arrayLayers);
+                auto cpuUpload = CreateBuffer(VkBufferType::Upload, bytes);
+                auto cpuReadback = CreateBuffer(VkBufferType::Readback, bytes);
+
+                ImageCopyPoint point;
+                point.format = fmt.name;
+                point.linear = linear;
+                point.layout = layout.name;
+                point.bytes = bytes;
+                const double batchGB = static_cast<double>(bytes) * copies / (1024.0 * 1024.0 * 1024.0);
+                const std::string sizeTag = " (" + FormatSize(bytes) + ")";
+
+                if (image && cpuUpload && cpuReadback &&
+                    TransitionBenchImage(image.image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)) {
+                    BenchmarkResult resUpload;
+                    resUpload.testName = "CPU->GPU Image " + label + sizeTag;
+                    resUpload.unit = "GB/s";
+                    SetCurrentTest(resUpload.testName);
+                    std::vector<double> bandwidths;
+                    int failedBatches = 0;
+                    RunTimestampedBatches(resUpload.testName, [&](VkCommandBuffer cmd) {
+                        for (int c = 0; c < copies; ++c) {
+                            vkCmdCopyBufferToImage(cmd, cpuUpload.buffer, image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                                   static_cast<uint32_t>(regions.size()), regions.data());
+                        }
+                    }, batchGB, batches, bandwidths, failedBatches);
+                    SummarizeBandwidthSamples(resUpload, bandwidths, failedBatches);
+                    if (!resUpload.samples.empty()) {
+                        point.upload = resUpload.avgValue;
+                        allResults.push_back(resUpload);
+                    }
 
-    VkDescriptorSet descSet = VK_NULL_HANDLE;
-    vkAllocateDescriptorSets(computeDevice, &descAllocInfo, &descSet);
+                    if (!ShouldAbortBenchmark() &&
+                        TransitionBenchImage(image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)) {
+                        BenchmarkResult resDownload;
+                        resDownload.testName = "GPU->CPU Image " + label + sizeTag;
+                        resDownload.unit = "GB/s";
+                        SetCurrentTest(resDownload.testName);
+                        bandwidths.clear();
+                        failedBatches = 0;
+                        RunTimestampedBatches(resDownload.testName, [&](VkCommandBuffer cmd) {
+                            for (int c = 0; c < copies; ++c) {
+                                vkCmdCopyImageToBuffer(cmd, image.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, cpuReadback.buffer,
+                                                       static_cast<uint32_t>(regions.size()), regions.data());
+                            }
+                        }, batchGB, batches, bandwidths, failedBatches);
+                        SummarizeBandwidthSamples(resDownload, bandwidths, failedBatches);
+                        if (!resDownload.samples.empty()) {
+                            point.download = resDownload.avgValue;
+                            allResults.push_back(resDownload);
+                        }
+                    }
 
-    // Update descriptor set
-    VkDescriptorBufferInfo bufferDesc = {};
-    bufferDesc.buffer = chainBuffer.buffer;
-    bufferDesc.offset = 0;
-    bufferDesc.range = VK_WHOLE_SIZE;
+                    char line[160];
+                    snprintf(line, sizeof(line), "  %-22s %9s: CPU->GPU %6.2f GB/s, GPU->CPU %6.2f GB/s",
+                             label.c_str(), FormatSize(bytes).c_str(), point.upload, point.download);
+                    Log(line);
+                    imageResult.points.push_back(point);
+                } else {
+                    Log("[ERROR] Failed to set up " + label + " image copy");
+                }
 
-    VkWriteDescriptorSet writeDesc = {};
-    writeDesc.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    writeDesc.dstSet = descSet;
-    writeDesc.dstBinding = 0;
-    writeDesc.descriptorCount = 1;
-    writeDesc.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    writeDesc.pBufferInfo = &bufferDesc;
+                image.Destroy(Bench().device);
+                cpuUpload.Destroy(Bench().device);
+                cpuReadback.Destroy(Bench().device);
+            }
+        }
+    }
 
-    vkUpdateDescriptorSets(computeDevice, 1, &writeDesc, 0, nullptr);
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.imageCopy = std::move(imageResult);
+}
 
-    // 12. Create timestamp query pool
+// ----------------------------------------------------------------------------
+// Per-copy timing
+// ----------------------------------------------------------------------------
+// The bandwidth batches time all copies of a batch as one interval. Here a
+// timestamp follows every copy, so the first copy of a batch - which pays for
+// TLB / page-table warm-up after the idle gap between submits - can be told
+// apart from the copies behind it. Batches are submitted one at a time, so
+// every batch starts cold like an isolated upload. Copies in a batch are not
+// separated by barriers (as in the bandwidth test), so each duration is the
+// interval between successive copy completions.
+
+// Times `batches` serial batches of `copies` src -> dst copies. Per-batch
+// first-copy and steady-state bandwidths are appended to firstSamples and
+// steadySamples.
+void TimePerCopyBatches(const std::string& name, VkBuffer src, VkBuffer dst, size_t size, int copies, int batches,
+                        PerCopyTiming& timing, std::vector<double>& firstSamples, std::vector<double>& steadySamples) {
+    SetCurrentTest(name);
+    const uint32_t queryCount = static_cast<uint32_t>(copies) + 1;
     VkQueryPoolCreateInfo queryPoolInfo = {};
     queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
     queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
-    queryPoolInfo.queryCount = 2;
-
+    queryPoolInfo.queryCount = queryCount;
     VkQueryPool queryPool = VK_NULL_HANDLE;
-    vkCreateQueryPool(computeDevice, &queryPoolInfo, nullptr, &queryPool);
+    if (vkCreateQueryPool(Bench().device, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS) {
+        Log("[ERROR] Failed to create timestamp query pool in per-copy test");
+        return;
+    }
 
-    // Fence for dispatch synchronization
-    VkFence dispatchFence = VK_NULL_HANDLE;
-    {
-        VkFenceCreateInfo fenceCI = {};
-        fenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        vkCreateFence(computeDevice, &fenceCI, nullptr, &dispatchFence);
+    // [query reset, batch with a timestamp before the first copy and after each copy]
+    std::vector<VkCommandBuffer> cmds = AllocateBenchCommandBuffers(2);
+    if (cmds.empty()) {
+        vkDestroyQueryPool(Bench().device, queryPool, nullptr);
+        return;
     }
+    BeginReusableCommandBuffer(cmds[0]);
+    vkCmdResetQueryPool(cmds[0], queryPool, 0, queryCount);
+    vkEndCommandBuffer(cmds[0]);
 
-    // Push constants
-    struct LatencyParams {
-        uint32_t numChases;
-        uint32_t startIndex;
-    };
-    LatencyParams params = { Constants::MEMORY_LATENCY_NUM_CHASES, 0 };
+    BeginReusableCommandBuffer(cmds[1]);
+    vkCmdWriteTimestamp(cmds[1], VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, 0);
+    for (int k = 0; k < copies; ++k) {
+        RecordBenchCopies(cmds[1], src, dst, size, 1);
+        vkCmdWriteTimestamp(cmds[1], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, static_cast<uint32_t>(k) + 1);
+    }
+    vkEndCommandBuffer(cmds[1]);
 
-    // 13. Warmup dispatches
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Running " + std::to_string(Constants::MEMORY_LATENCY_WARMUP_DISPATCHES) + " warmup dispatches...");
-    for (int w = 0; w < Constants::MEMORY_LATENCY_WARMUP_DISPATCHES && !ShouldAbortBenchmark(); w++) {
-        vkResetCommandBuffer(computeCmdBuf, 0);
+    SubmitAndWait(cmds.data(), 2);  // Warm-up
 
-        VkCommandBufferBeginInfo beginInfo = {};
-        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        vkBeginCommandBuffer(computeCmdBuf, &beginInfo);
+    const double copyGB = static_cast<double>(size) / (1024.0 * 1024.0 * 1024.0);
+    std::vector<double> copySeconds(copies, 0.0);  // Summed over batches
+    std::vector<uint64_t> timestamps(queryCount);
+    std::vector<double> durations(copies);
+    double cvSum = 0;
 
-        vkCmdBindPipeline(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
-        vkCmdBindDescriptorSets(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
-            pipelineLayout, 0, 1, &descSet, 0, nullptr);
-        vkCmdPushConstants(computeCmdBuf, pipelineLayout,
-            VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(params), &params);
-        vkCmdDispatch(computeCmdBuf, 1, 1, 1);
+    for (int b = 0; b < batches && !ShouldAbortBenchmark(); ++b) {
+        FenceWaitResult fenceResult = SubmitAndWait(cmds.data(), 2);
+        if (fenceResult != FenceWaitResult::Success) break;
+        if (vkGetQueryPoolResults(Bench().device, queryPool, 0, queryCount, timestamps.size() * sizeof(uint64_t),
+                                  timestamps.data(), sizeof(uint64_t),
+                                  VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT) != VK_SUCCESS) {
+            continue;
+        }
 
-        vkEndCommandBuffer(computeCmdBuf);
+        bool valid = true;
+        for (int k = 0; k < copies && valid; ++k) {
+            valid = timestamps[k + 1] > timestamps[k];
+            durations[k] = static_cast<double>(timestamps[k + 1] - timestamps[k]) *
+                           static_cast<double>(Bench().timestampPeriod) / 1e9;
+        }
+        if (!valid) continue;
+
+        const double mean = std::accumulate(durations.begin(), durations.end(), 0.0) / copies;
+        double variance = 0;
+        for (double d : durations) variance += (d - mean) * (d - mean);
+        cvSum += std::sqrt(variance / copies) / mean * 100.0;
+
+        for (int k = 0; k < copies; ++k) copySeconds[k] += durations[k];
+        const double steady = std::accumulate(durations.begin() + 1, durations.end(), 0.0) / (copies - 1);
+        firstSamples.push_back(copyGB / durations[0]);
+        steadySamples.push_back(copyGB / steady);
+        timing.batches++;
+        g_app.progress = static_cast<float>(b + 1) / static_cast<float>(batches);
+    }
+
+    FreeBenchCommandBuffers(cmds);
+    vkDestroyQueryPool(Bench().device, queryPool, nullptr);
+    if (timing.batches == 0) return;
+
+    // Bandwidths from mean times, so a few fast outliers don't dominate
+    const double n = timing.batches;
+    for (double seconds : copySeconds) timing.copyGBps.push_back(copyGB / (seconds / n));
+    const double firstSeconds = copySeconds[0] / n;
+    const double steadySeconds = std::accumulate(copySeconds.begin() + 1, copySeconds.end(), 0.0) / n / (copies - 1);
+    timing.firstGBps = copyGB / firstSeconds;
+    timing.steadyGBps = copyGB / steadySeconds;
+    timing.coldPenaltyUs = (firstSeconds - steadySeconds) * 1e6;
+    timing.withinBatchCV = cvSum / n;
+}
 
-        vkResetFences(computeDevice, 1, &dispatchFence);
-        VkSubmitInfo submitInfo = {};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &computeCmdBuf;
-        vr = vkQueueSubmit(computeQueue, 1, &submitInfo, dispatchFence);
-        if (vr != VK_SUCCESS) {
-            Log("[ERROR] Warmup dispatch " + std::to_string(w) + " submit failed: " + std::to_string((int)vr));
-        }
-        vr = vkWaitForFences(computeDevice, 1, &dispatchFence, VK_TRUE, Constants::FENCE_WAIT_TIMEOUT_MS * 1000000ULL);
-        if (vr != VK_SUCCESS) {
-            Log("[ERROR] Warmup dispatch " + std::to_string(w) + " fence wait failed: " + std::to_string((int)vr));
+void RunPerCopyTimingTest(std::vector<BenchmarkResult>& allResults) {
+    const size_t size = g_app.config.bandwidthSize;
+    const int copies = std::max(g_app.config.copiesPerBatch, 2);
+    const int batches = std::min(g_app.config.bandwidthBatches, Constants::PER_COPY_MAX_BATCHES);
+
+    Log("--- Per-copy timing: " + std::to_string(copies) + " x " + FormatSize(size) + " per batch ---");
+    if (Bench().timestampPeriod == 0) {
+        Log("[WARNING] GPU timestamps not supported - skipping per-copy timing");
+        return;
+    }
+
+    auto cpuUpload = CreateBuffer(VkBufferType::Upload, size);
+    auto gpuBuffer = CreateBuffer(VkBufferType::DeviceLocal, size);
+    auto cpuReadback = CreateBuffer(VkBufferType::Readback, size);
+
+    PerCopyResult perCopy;
+    if (!cpuUpload || !gpuBuffer || !cpuReadback) {
+        Log("[CRITICAL] Failed to allocate per-copy timing buffers - skipping");
+    } else {
+        perCopy.copySize = size;
+        struct Direction {
+            const char*    label;
+            VkBuffer       src, dst;
+            PerCopyTiming& timing;
+        };
+        Direction directions[] = {
+            { "CPU->GPU", cpuUpload.buffer, gpuBuffer.buffer, perCopy.upload },
+            { "GPU->CPU", gpuBuffer.buffer, cpuReadback.buffer, perCopy.download },
+        };
+        for (auto& dir : directions) {
+            if (ShouldAbortBenchmark()) break;
+            const std::string suffix = std::string(dir.label) + " " + FormatSize(size);
+            std::vector<double> firstSamples, steadySamples;
+            TimePerCopyBatches("Per-Copy " + suffix, dir.src, dir.dst, size, copies, batches,
+                               dir.timing, firstSamples, steadySamples);
+            if (dir.timing.batches == 0) {
+                Log("[WARNING] Per-copy timing produced no valid batches for " + std::string(dir.label));
+                continue;
+            }
+
+            BenchmarkResult first, steady;
+            first.testName = "First Copy " + suffix;
+            steady.testName = "Steady Copies " + suffix;
+            first.unit = steady.unit = "GB/s";
+            SummarizeBandwidthSamples(first, firstSamples, 0);
+            SummarizeBandwidthSamples(steady, steadySamples, 0);
+            allResults.push_back(first);
+            allResults.push_back(steady);
+
+            char line[200];
+            snprintf(line, sizeof(line), "  %s: first copy %.2f GB/s, steady %.2f GB/s (+%.1f us cold), "
+                     "within-batch CV %.1f%%", dir.label, dir.timing.firstGBps, dir.timing.steadyGBps,
+                     dir.timing.coldPenaltyUs, dir.timing.withinBatchCV);
+            Log(line);
         }
     }
 
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Warmup dispatches complete");
+    cpuUpload.Destroy(Bench().device);
+    gpuBuffer.Destroy(Bench().device);
+    cpuReadback.Destroy(Bench().device);
 
-    if (ShouldAbortBenchmark()) goto cleanup;
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.perCopy = std::move(perCopy);
+}
 
-    // 14. Measurement dispatches
-    {
-        if (g_app.config.debugLogging)
-            Log("[DEBUG] Running " + std::to_string(Constants::MEMORY_LATENCY_MEASURE_DISPATCHES) + " measurement dispatches...");
-        int totalDispatches = Constants::MEMORY_LATENCY_MEASURE_DISPATCHES;
+// ----------------------------------------------------------------------------
+// Soak test
+// ----------------------------------------------------------------------------
+// Keeps the link saturated for minutes to hours and samples throughput once a
+// second. Retimer throttling and eGPU links renegotiating down only show up
+// well past the regular runs, as a step change or a slow slide, so each
+// second feeds a short and a long EWMA (step = they disagree for several
+// seconds) and a comparison against the baseline window (slide). The PCIe
+// link state is polled from sysfs alongside.
+
+// Rolling detector state behind SoakResult
+struct SoakTracker {
+    double fast = 0, slow = 0;          // EWMAs (GB/s)
+    int    stepHold = 0;                // Consecutive seconds past SOAK_STEP_THRESHOLD
+    double degradationLevel = 0;        // Fraction below baseline already reported
+    double baselineSum = 0;
+    int    baselineCount = 0;
+    double count = 0, sum = 0;          // Least-squares sums over (t, GB/s)
+    double sumT = 0, sumTT = 0, sumTY = 0;
+    double bucketSum = 0, bucketMin = 0;
+    int    bucketCount = 0;
+    double bucketStart = 0;
+};
 
-        for (int m = 0; m < totalDispatches && !ShouldAbortBenchmark(); m++) {
-            vkResetCommandBuffer(computeCmdBuf, 0);
+void AddSoakEvent(SoakResult& soak, double seconds, const std::string& description) {
+    Log("[SOAK] " + FormatDuration(seconds) + ": " + description);
+    if (soak.events.size() < Constants::SOAK_MAX_EVENTS) soak.events.push_back({ seconds, description });
+}
 
-            VkCommandBufferBeginInfo beginInfo = {};
-            beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-            beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-            vkBeginCommandBuffer(computeCmdBuf, &beginInfo);
+// Feeds one per-second throughput sample taken at `seconds`
+void AddSoakSample(SoakResult& soak, SoakTracker& tracker, double seconds, double gbps) {
+    char line[160];
+
+    // Aggregates and trend
+    if (tracker.count == 0) {
+        soak.min = soak.max = gbps;
+        tracker.fast = tracker.slow = gbps;
+    }
+    tracker.count += 1;
+    tracker.sum += gbps;
+    tracker.sumT += seconds;
+    tracker.sumTT += seconds * seconds;
+    tracker.sumTY += seconds * gbps;
+    soak.mean = tracker.sum / tracker.count;
+    soak.min = std::min(soak.min, gbps);
+    soak.max = std::max(soak.max, gbps);
+    soak.elapsedSeconds = seconds;
+
+    // Baseline: the SOAK_BASELINE_SECONDS samples after the first one, which
+    // still carries clock ramp-up
+    if (tracker.count > 1 && soak.baseline == 0) {
+        tracker.baselineSum += gbps;
+        if (++tracker.baselineCount >= Constants::SOAK_BASELINE_SECONDS) {
+            soak.baseline = tracker.baselineSum / tracker.baselineCount;
+        }
+    }
+    const double denom = tracker.count * tracker.sumTT - tracker.sumT * tracker.sumT;
+    if (soak.baseline > 0 && denom > 0) {
+        double slope = (tracker.count * tracker.sumTY - tracker.sumT * tracker.sum) / denom;  // GB/s per second
+        soak.trendPctPerHour = slope * 3600.0 / soak.baseline * 100.0;
+    }
+
+    // Step changes: short average leaves the long one and stays away
+    tracker.fast += (gbps - tracker.fast) * (1.0 - std::exp(-1.0 / Constants::SOAK_FAST_SECONDS));
+    tracker.slow += (gbps - tracker.slow) * (1.0 - std::exp(-1.0 / Constants::SOAK_SLOW_SECONDS));
+    if (soak.baseline > 0) {
+        bool away = tracker.slow > 0 && std::abs(tracker.fast - tracker.slow) / tracker.slow > Constants::SOAK_STEP_THRESHOLD;
+        tracker.stepHold = away ? tracker.stepHold + 1 : 0;
+        if (tracker.stepHold >= Constants::SOAK_STEP_HOLD_SECONDS) {
+            snprintf(line, sizeof(line), "Step change %.2f -> %.2f GB/s", tracker.slow, tracker.fast);
+            AddSoakEvent(soak, seconds, line);
+            tracker.slow = tracker.fast;
+            tracker.stepHold = 0;
+        }
+
+        // Slow degradation: long average sinks below the baseline
+        while (tracker.slow < soak.baseline * (1.0 - tracker.degradationLevel - Constants::SOAK_DEGRADATION_STEP)) {
+            tracker.degradationLevel += Constants::SOAK_DEGRADATION_STEP;
+            snprintf(line, sizeof(line), "Throughput %.0f%% below baseline (%.2f of %.2f GB/s)",
+                     tracker.degradationLevel * 100.0, tracker.slow, soak.baseline);
+            AddSoakEvent(soak, seconds, line);
+        }
+    }
+
+    // Bounded series: bucketSeconds samples per point, resolution halved when full
+    if (tracker.bucketCount == 0) {
+        tracker.bucketStart = seconds;
+        tracker.bucketMin = gbps;
+    }
+    tracker.bucketSum += gbps;
+    tracker.bucketMin = std::min(tracker.bucketMin, gbps);
+    if (++tracker.bucketCount < soak.bucketSeconds) return;
+
+    soak.series.push_back({ tracker.bucketStart, tracker.bucketSum / tracker.bucketCount, tracker.bucketMin });
+    tracker.bucketSum = 0;
+    tracker.bucketCount = 0;
+    if (soak.series.size() >= Constants::SOAK_SERIES_CAPACITY) {
+        std::vector<SoakPoint> merged;
+        merged.reserve(Constants::SOAK_SERIES_CAPACITY);
+        for (size_t i = 0; i + 1 < soak.series.size(); i += 2) {
+            const SoakPoint& a = soak.series[i];
+            const SoakPoint& b = soak.series[i + 1];
+            merged.push_back({ a.seconds, (a.gbps + b.gbps) / 2.0, std::min(a.minGbps, b.minGbps) });
+        }
+        soak.series = std::move(merged);
+        soak.bucketSeconds *= 2;
+    }
+}
 
-            // Reset and write start timestamp
-            vkCmdResetQueryPool(computeCmdBuf, queryPool, 0, 2);
-            vkCmdWriteTimestamp(computeCmdBuf, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, 0);
+// "Gen4 x16" from the GPU's sysfs link attributes, empty if unavailable
+std::string ReadCurrentPCIeLink(const GPUInfo& gpu) {
+    if (gpu.pcieLocationPath.empty()) return "";
+    const std::string base = SysfsPath("/bus/pci/devices/" + gpu.pcieLocationPath);
+    int gen = ParsePCIeLinkSpeedToGen(ReadSysfsFile(base + "/current_link_speed"));
+    int lanes = ParsePCIeLinkWidth(ReadSysfsFile(base + "/current_link_width"));
+    if (gen == 0 || lanes == 0) return "";
+    return "Gen" + std::to_string(gen) + " x" + std::to_string(lanes);
+}
 
-            // Bind and dispatch
-            vkCmdBindPipeline(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
-            vkCmdBindDescriptorSets(computeCmdBuf, VK_PIPELINE_BIND_POINT_COMPUTE,
-                pipelineLayout, 0, 1, &descSet, 0, nullptr);
-            vkCmdPushConstants(computeCmdBuf, pipelineLayout,
-                VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(params), &params);
-            vkCmdDispatch(computeCmdBuf, 1, 1, 1);
+// Streams the configured traffic for soakMinutes, one copy of bandwidthSize
+// per direction and submit, and publishes the running SoakResult every second
+void RunSoakTest(std::vector<BenchmarkResult>& allResults) {
+    const size_t size = g_app.config.bandwidthSize;
+    const SoakTraffic traffic = g_app.config.soakTraffic;
+    const GPUInfo& gpu = g_app.gpuList[g_app.config.selectedGPU];
+    SetCurrentTest(std::string("Soak ") + SoakTrafficName(traffic));
 
-            // Write end timestamp
-            vkCmdWriteTimestamp(computeCmdBuf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, queryPool, 1);
+    SoakResult soak;
+    soak.traffic = traffic;
+    soak.durationSeconds = g_app.config.soakMinutes * 60.0;
+    SoakTracker tracker;
+    {
+        std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+        g_app.soak = soak;
+    }
+    Log("--- Soak: " + std::string(SoakTrafficName(traffic)) + " " + FormatSize(size) + " for " +
+        std::to_string(g_app.config.soakMinutes) + " min ---");
 
-            vkEndCommandBuffer(computeCmdBuf);
+    auto cpuUpload = CreateBuffer(VkBufferType::Upload, size);
+    auto gpuDst = CreateBuffer(VkBufferType::DeviceLocal, size);
+    auto gpuSrc = CreateBuffer(VkBufferType::DeviceLocal, size);
+    auto cpuReadback = CreateBuffer(VkBufferType::Readback, size);
+    std::vector<VkCommandBuffer> cmds = AllocateBenchCommandBuffers(2);  // [upload, download]
+    if (!cpuUpload || !gpuDst || !gpuSrc || !cpuReadback || cmds.empty()) {
+        Log("[ERROR] Failed to allocate soak test resources");
+    } else {
+        BeginReusableCommandBuffer(cmds[0]);
+        RecordBenchCopies(cmds[0], cpuUpload.buffer, gpuDst.buffer, size, 1);
+        vkEndCommandBuffer(cmds[0]);
+        BeginReusableCommandBuffer(cmds[1]);
+        RecordBenchCopies(cmds[1], gpuSrc.buffer, cpuReadback.buffer, size, 1);
+        vkEndCommandBuffer(cmds[1]);
+
+        // Bidirectional runs the download on queue2 when there is one, as
+        // RunBidirectionalTest() does; otherwise both go back to back
+        const bool dualQueue = traffic == SoakTraffic::Bidirectional && Bench().hasDualQueues;
+        auto submitOnce = [&]() -> bool {
+            switch (traffic) {
+                case SoakTraffic::Upload:   return SubmitAndWait(&cmds[0], 1) == FenceWaitResult::Success;
+                case SoakTraffic::Download: return SubmitAndWait(&cmds[1], 1) == FenceWaitResult::Success;
+                case SoakTraffic::Bidirectional: break;
+            }
+            if (!dualQueue) return SubmitAndWait(cmds.data(), 2) == FenceWaitResult::Success;
 
-            vkResetFences(computeDevice, 1, &dispatchFence);
             VkSubmitInfo submitInfo = {};
             submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
             submitInfo.commandBufferCount = 1;
-            submitInfo.pCommandBuffers = &computeCmdBuf;
-            vr = vkQueueSubmit(computeQueue, 1, &submitInfo, dispatchFence);
-            if (vr != VK_SUCCESS) {
-                Log("[ERROR] Measurement dispatch " + std::to_string(m) + " submit failed: " + std::to_string((int)vr));
-                continue;
-            }
-            vr = vkWaitForFences(computeDevice, 1, &dispatchFence, VK_TRUE, Constants::FENCE_WAIT_TIMEOUT_MS * 1000000ULL);
-            if (vr != VK_SUCCESS) {
-                Log("[ERROR] Measurement dispatch " + std::to_string(m) + " fence wait failed: " + std::to_string((int)vr));
-                continue;
+            submitInfo.pCommandBuffers = &cmds[1];
+            if (vkQueueSubmit(Bench().queue2, 1, &submitInfo, Bench().fence2) != VK_SUCCESS) return false;
+            bool uploaded = SubmitAndWait(&cmds[0], 1) == FenceWaitResult::Success;
+            uint64_t timeout = static_cast<uint64_t>(Constants::FENCE_WAIT_TIMEOUT_MS) * 1000000ULL;
+            bool downloaded = vkWaitForFences(Bench().device, 1, &Bench().fence2, VK_TRUE, timeout) == VK_SUCCESS;
+            vkResetFences(Bench().device, 1, &Bench().fence2);
+            return uploaded && downloaded;
+        };
+        const double submitGB = static_cast<double>(size) * (traffic == SoakTraffic::Bidirectional ? 2 : 1) /
+                                (1024.0 * 1024.0 * 1024.0);
+
+        std::string link = ReadCurrentPCIeLink(gpu);
+        if (!link.empty()) Log("  PCIe link at start: " + link);
+
+        submitOnce();  // Warm-up, kept out of the first window
+        const auto start = std::chrono::steady_clock::now();
+        auto windowStart = start;
+        double windowGB = 0.0;
+        int secondsSinceLinkPoll = 0;
+        while (!ShouldAbortBenchmark()) {
+            if (!submitOnce()) {
+                AddSoakEvent(soak, soak.elapsedSeconds, "Copy failed or timed out - soak stopped");
+                break;
             }
-
-            // Read timestamps
-            uint64_t timestamps[2] = {};
-            vr = vkGetQueryPoolResults(computeDevice, queryPool, 0, 2,
-                sizeof(timestamps), timestamps, sizeof(uint64_t),
-                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
-
-            if (g_app.config.debugLogging && m == 0) {
-                Log("[DEBUG] Timestamp query result: " + std::to_string((int)vr) +
-                    ", ts[0]=" + std::to_string(timestamps[0]) +
-                    ", ts[1]=" + std::to_string(timestamps[1]) +
-                    ", period=" + std::to_string(timestampPeriod) + " ns/tick");
+            windowGB += submitGB;
+
+            const auto now = std::chrono::steady_clock::now();
+            const double windowSeconds = std::chrono::duration<double>(now - windowStart).count();
+            if (windowSeconds < 1.0) continue;
+
+            const double elapsed = std::chrono::duration<double>(now - start).count();
+            AddSoakSample(soak, tracker, elapsed, windowGB / windowSeconds);
+            windowStart = now;
+            windowGB = 0.0;
+
+            if (++secondsSinceLinkPoll >= Constants::SOAK_LINK_POLL_SECONDS) {
+                secondsSinceLinkPoll = 0;
+                std::string current = ReadCurrentPCIeLink(gpu);
+                if (!current.empty() && current != link) {
+                    AddSoakEvent(soak, elapsed, "PCIe link changed: " + (link.empty() ? "?" : link) + " -> " + current);
+                    link = current;
+                }
             }
 
-            if (vr == VK_SUCCESS && timestamps[1] > timestamps[0]) {
-                double totalNs = static_cast<double>(timestamps[1] - timestamps[0]) * timestampPeriod;
-                double perChaseNs = totalNs / Constants::MEMORY_LATENCY_NUM_CHASES;
-                result.samples.push_back(perChaseNs);
-            } else if (m == 0) {
-                Log("[WARNING] Invalid timestamps on first measurement: vr=" + std::to_string((int)vr) +
-                    " ts[0]=" + std::to_string(timestamps[0]) +
-                    " ts[1]=" + std::to_string(timestamps[1]));
+            g_app.progress = static_cast<float>(std::min(elapsed / soak.durationSeconds, 1.0));
+            {
+                std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+                g_app.soak = soak;
             }
-
-            g_app.progress = static_cast<float>(m + 1) / totalDispatches;
+            if (elapsed >= soak.durationSeconds) break;
         }
     }
+    FreeBenchCommandBuffers(cmds);
+    cpuUpload.Destroy(Bench().device);
+    gpuDst.Destroy(Bench().device);
+    gpuSrc.Destroy(Bench().device);
+    cpuReadback.Destroy(Bench().device);
+    if (soak.empty()) return;
 
-    // 15. Calculate statistics
-    if (g_app.config.debugLogging)
-        Log("[DEBUG] Memory latency test collected " + std::to_string(result.samples.size()) + " valid samples");
-
-    if (!result.samples.empty()) {
-        std::sort(result.samples.begin(), result.samples.end());
-        result.minValue = result.samples.front();
-        result.maxValue = result.samples.back();
-        double sum = 0;
-        for (double s : result.samples) sum += s;
-        result.avgValue = sum / result.samples.size();
-
-        if (g_app.config.debugLogging)
-            Log("[DEBUG] GPU Memory Latency: min=" + std::to_string(result.minValue) +
-                " avg=" + std::to_string(result.avgValue) +
-                " max=" + std::to_string(result.maxValue) + " ns");
-    } else {
-        Log("[WARNING] No valid memory latency samples collected");
-    }
+    // The bounded series stands in for the per-second samples
+    BenchmarkResult result;
+    result.testName = std::string("Soak ") + SoakTrafficName(traffic) + " " + FormatSize(size) +
+                      " (" + FormatDuration(soak.elapsedSeconds) + ")";
+    result.unit = "GB/s";
+    for (const auto& point : soak.series) result.samples.push_back(point.gbps);
+    result.minValue = soak.min;
+    result.maxValue = soak.max;
+    result.avgValue = soak.mean;
+    allResults.push_back(result);
 
-cleanup:
-    // 16. Cleanup — destroy everything on the compute device, then destroy the device itself
-    vkDeviceWaitIdle(computeDevice);
-    vkDestroyFence(computeDevice, dispatchFence, nullptr);
-    vkDestroyQueryPool(computeDevice, queryPool, nullptr);
-    vkDestroyDescriptorPool(computeDevice, descPool, nullptr);
-    chainBuffer.Destroy(computeDevice);
-    vkDestroyPipeline(computeDevice, pipeline, nullptr);
-    vkDestroyPipelineLayout(computeDevice, pipelineLayout, nullptr);
-    vkDestroyDescriptorSetLayout(computeDevice, descSetLayout, nullptr);
-    vkDestroyShaderModule(computeDevice, shaderModule, nullptr);
-    vkDestroyCommandPool(computeDevice, computeCommandPool, nullptr);
-    vkDestroyDevice(computeDevice, nullptr);
+    char line[192];
+    snprintf(line, sizeof(line), "  Soak: mean %.2f GB/s (min %.2f, max %.2f), baseline %.2f, trend %+.2f%%/h, %zu event(s)",
+             soak.mean, soak.min, soak.max, soak.baseline, soak.trendPctPerHour, soak.events.size());
+    Log(line);
 
-    return result;
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.soak = std::move(soak);
 }
 
 void BenchmarkThreadFunc() {
     g_app.benchmarkThreadRunning = true;
     g_app.benchmarkStartTime = std::chrono::steady_clock::now();
     g_app.benchmarkAborted = false;
-    g_app.fenceTimeoutCount = 0;
+    Bench().fenceTimeoutCount = 0;
     
     Log("=== Benchmark Started ===");
     Log("GPU: " + g_app.gpuList[g_app.config.selectedGPU].name);
@@ -4659,10 +9467,20 @@ void BenchmarkThreadFunc() {
     }
     Log("Batches: " + std::to_string(g_app.config.bandwidthBatches));
     Log("Copies/Batch: " + std::to_string(g_app.config.copiesPerBatch));
+    if (g_app.config.adaptiveSampling) {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "Adaptive sampling: 95%% CI within %.1f%%, %d s budget per test",
+                 g_app.config.adaptiveCIPercent, g_app.config.adaptiveBudgetSec);
+        Log(buf);
+    }
     Log("Runs: " + std::to_string(g_app.config.numRuns));
+    if (g_app.config.runHostImport) {
+        Log("Imported host memory: " + std::string(HostPageModeName(g_app.config.hostPageMode)) + " pages");
+    }
     Log("Average Runs: " + std::string(g_app.config.averageRuns ? "Yes" : "No (individual)"));
     Log("=========================");
 
+    ApplyGPUNumaPlacement(g_app.config.selectedGPU);
     if (!InitBenchmarkDevice(g_app.config.selectedGPU)) {
         Log("[ERROR] Failed to initialize benchmark device!");
         g_app.state = AppState::Idle;
@@ -4677,10 +9495,12 @@ void BenchmarkThreadFunc() {
     //   CPU round-trip  → identical logic on COPY queue
     if (isIntegratedGPU) {
         Log("[METHOD] Upload: GPU timestamps, Download: GPU timestamps, Bidirectional: " +
-            std::string(g_app.hasDualQueues ? "dual copy queues" : "single queue interleaved"));
+            std::string(Bench().hasDualQueues ? "dual copy queues" : "single queue interleaved"));
     } else {
-        Log("[METHOD] Upload: CPU round-trip, Download: GPU timestamps, Bidirectional: " +
-            std::string(g_app.hasDualQueues ? "dual copy queues" : "single queue interleaved"));
+        Log(std::string("[METHOD] Upload: ") +
+            (Bench().calibration.valid ? "calibrated timestamps (host timeline)" : "CPU round-trip") +
+            ", Download: GPU timestamps, Bidirectional: " +
+            std::string(Bench().hasDualQueues ? "dual copy queues" : "single queue interleaved"));
     }
 
     std::vector<BenchmarkResult> allResults;
@@ -4692,8 +9512,18 @@ void BenchmarkThreadFunc() {
     int testsPerRun = 2;  // Upload + Download
     if (g_app.config.runBidirectional) testsPerRun++;
     if (g_app.config.runLatency) testsPerRun += 3;
+    if (g_app.config.runHostImport) testsPerRun += g_app.config.runLatency ? 4 : 2;
     g_app.totalTests = testsPerRun * g_app.config.numRuns;
     if (g_app.config.runMemoryLatency) g_app.totalTests++;  // Memory latency runs once (hardware constant)
+    if (g_app.config.runSizeSweep) g_app.totalTests++;      // Sweep runs once, after the fixed-size runs
+    if (g_app.config.runQueueScaling) g_app.totalTests++;   // Queue scaling too
+    if (g_app.config.runNumaRemote) g_app.totalTests++;     // And the remote-node comparison
+    if (g_app.config.runDirectAccess) g_app.totalTests++;   // And CPU direct VRAM access
+    if (g_app.config.runComputeCopy) g_app.totalTests++;    // And compute vs. DMA copies
+    if (g_app.config.runScatterCopy) g_app.totalTests++;    // And many-region copies
+    if (g_app.config.runImageCopy) g_app.totalTests++;      // And buffer <-> image copies
+    if (g_app.config.runPerCopyTiming) g_app.totalTests++;  // And per-copy timestamps
+    if (g_app.config.runSoak) g_app.totalTests++;           // And the soak run
 
     double avgUpload = 0, avgDownload = 0;
     double maxUpload = 0, maxDownload = 0;
@@ -4723,8 +9553,8 @@ void BenchmarkThreadFunc() {
             Log("[CRITICAL] Failed to allocate download buffers - skipping download test");
             g_app.completedTests++;
             g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
-            gpuSrc.Destroy(g_app.benchDevice);
-            cpuReadback.Destroy(g_app.benchDevice);
+            gpuSrc.Destroy(Bench().device);
+            cpuReadback.Destroy(Bench().device);
         } else {
             auto resDownload = RunBandwidthTest("GPU->CPU " + FormatSize(g_app.config.bandwidthSize) + runSuffix,
                 gpuSrc, cpuReadback,
@@ -4743,8 +9573,8 @@ void BenchmarkThreadFunc() {
                 Log("[WARNING] Download test produced no valid samples");
             }
             
-            gpuSrc.Destroy(g_app.benchDevice);
-            cpuReadback.Destroy(g_app.benchDevice);
+            gpuSrc.Destroy(Bench().device);
+            cpuReadback.Destroy(Bench().device);
             
             g_app.completedTests++;
             g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
@@ -4766,8 +9596,8 @@ void BenchmarkThreadFunc() {
         }
         
         if (runHadCriticalFailure) {
-            cpuUpload.Destroy(g_app.benchDevice);
-            gpuDefault.Destroy(g_app.benchDevice);
+            cpuUpload.Destroy(Bench().device);
+            gpuDefault.Destroy(Bench().device);
             g_app.completedTests += (testsPerRun - 1);
             g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
             continue;
@@ -4791,13 +9621,24 @@ void BenchmarkThreadFunc() {
             Log("[WARNING] Upload test produced no valid samples");
         }
         
-        cpuUpload.Destroy(g_app.benchDevice);
-        gpuDefault.Destroy(g_app.benchDevice);
+        cpuUpload.Destroy(Bench().device);
+        gpuDefault.Destroy(Bench().device);
         
         g_app.completedTests++;
         g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
         if (ShouldAbortBenchmark()) break;
 
+        // Same transfers from application-owned pages
+        if (g_app.config.runHostImport) {
+            if (Bench().getMemoryHostPointerProperties) {
+                RunImportedHostTests(runSuffix, useRoundTrip, allResults);
+            } else {
+                g_app.completedTests += g_app.config.runLatency ? 4 : 2;
+                g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+            }
+            if (ShouldAbortBenchmark()) break;
+        }
+
         // Bidirectional
         if (g_app.config.runBidirectional) {
             auto resBidir = RunBidirectionalTest(g_app.config.bandwidthSize, g_app.config.copiesPerBatch, g_app.config.bandwidthBatches);
@@ -4820,10 +9661,10 @@ void BenchmarkThreadFunc() {
 
             if (!latCpuUpload || !latGpuDefault || !latGpuSrc || !latCpuReadback) {
                 Log("[CRITICAL] Failed to allocate latency buffers - skipping latency tests");
-                latCpuUpload.Destroy(g_app.benchDevice);
-                latGpuDefault.Destroy(g_app.benchDevice);
-                latGpuSrc.Destroy(g_app.benchDevice);
-                latCpuReadback.Destroy(g_app.benchDevice);
+                latCpuUpload.Destroy(Bench().device);
+                latGpuDefault.Destroy(Bench().device);
+                latGpuSrc.Destroy(Bench().device);
+                latCpuReadback.Destroy(Bench().device);
                 g_app.completedTests += 3;
                 g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
                 continue;
@@ -4836,10 +9677,10 @@ void BenchmarkThreadFunc() {
             RunCommandLatencyTest(Constants::LATENCY_WARMUP_ITERATIONS);
 
             if (ShouldAbortBenchmark()) {
-                latCpuUpload.Destroy(g_app.benchDevice);
-                latGpuDefault.Destroy(g_app.benchDevice);
-                latGpuSrc.Destroy(g_app.benchDevice);
-                latCpuReadback.Destroy(g_app.benchDevice);
+                latCpuUpload.Destroy(Bench().device);
+                latGpuDefault.Destroy(Bench().device);
+                latGpuSrc.Destroy(Bench().device);
+                latCpuReadback.Destroy(Bench().device);
                 break;
             }
 
@@ -4851,10 +9692,10 @@ void BenchmarkThreadFunc() {
             g_app.completedTests++;
             g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
             if (ShouldAbortBenchmark()) {
-                latCpuUpload.Destroy(g_app.benchDevice);
-                latGpuDefault.Destroy(g_app.benchDevice);
-                latGpuSrc.Destroy(g_app.benchDevice);
-                latCpuReadback.Destroy(g_app.benchDevice);
+                latCpuUpload.Destroy(Bench().device);
+                latGpuDefault.Destroy(Bench().device);
+                latGpuSrc.Destroy(Bench().device);
+                latCpuReadback.Destroy(Bench().device);
                 break;
             }
 
@@ -4866,10 +9707,10 @@ void BenchmarkThreadFunc() {
             g_app.completedTests++;
             g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
             if (ShouldAbortBenchmark()) {
-                latCpuUpload.Destroy(g_app.benchDevice);
-                latGpuDefault.Destroy(g_app.benchDevice);
-                latGpuSrc.Destroy(g_app.benchDevice);
-                latCpuReadback.Destroy(g_app.benchDevice);
+                latCpuUpload.Destroy(Bench().device);
+                latGpuDefault.Destroy(Bench().device);
+                latGpuSrc.Destroy(Bench().device);
+                latCpuReadback.Destroy(Bench().device);
                 break;
             }
 
@@ -4882,10 +9723,10 @@ void BenchmarkThreadFunc() {
             g_app.completedTests++;
             g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
             
-            latCpuUpload.Destroy(g_app.benchDevice);
-            latGpuDefault.Destroy(g_app.benchDevice);
-            latGpuSrc.Destroy(g_app.benchDevice);
-            latCpuReadback.Destroy(g_app.benchDevice);
+            latCpuUpload.Destroy(Bench().device);
+            latGpuDefault.Destroy(Bench().device);
+            latGpuSrc.Destroy(Bench().device);
+            latCpuReadback.Destroy(Bench().device);
 
             if (ShouldAbortBenchmark()) break;
         }
@@ -4906,6 +9747,63 @@ void BenchmarkThreadFunc() {
         successfulRuns++;
     }
 
+    if (g_app.config.runSizeSweep && !ShouldAbortBenchmark()) {
+        RunSizeSweep(!isIntegratedGPU);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runQueueScaling && !ShouldAbortBenchmark()) {
+        RunQueueScalingTest();
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runDirectAccess && !ShouldAbortBenchmark()) {
+        RunDirectAccessTest(uploadCount ? avgUpload / uploadCount : 0.0,
+                            downloadCount ? avgDownload / downloadCount : 0.0, allResults);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runComputeCopy && !ShouldAbortBenchmark()) {
+        RunComputeCopyTest(uploadCount ? avgUpload / uploadCount : 0.0,
+                           downloadCount ? avgDownload / downloadCount : 0.0, allResults);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runScatterCopy && !ShouldAbortBenchmark()) {
+        RunScatterCopyTest(allResults);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runImageCopy && !ShouldAbortBenchmark()) {
+        RunImageCopyTest(uploadCount ? avgUpload / uploadCount : 0.0,
+                         downloadCount ? avgDownload / downloadCount : 0.0, allResults);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runPerCopyTiming && !ShouldAbortBenchmark()) {
+        RunPerCopyTimingTest(allResults);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runNumaRemote && !ShouldAbortBenchmark()) {
+        RunNumaRemoteComparison(!isIntegratedGPU, allResults);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    if (g_app.config.runSoak && !ShouldAbortBenchmark()) {
+        RunSoakTest(allResults);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
     CleanupBenchmarkDevice();
 
     if (g_app.cancelRequested) {
@@ -5147,6 +10045,442 @@ void BenchmarkThreadFunc() {
     g_app.benchmarkThreadRunning = false;
 }
 
+// ----------------------------------------------------------------------------
+// GPU-to-GPU peer copies
+// ----------------------------------------------------------------------------
+// For every ordered pair (src, dst) the destination GPU exports a device-local
+// buffer as a dma-buf, the source GPU imports it, and the source's transfer
+// queue copies from its own VRAM into the import: a peer write. Opaque FDs
+// only import on the same physical device, so the direct path needs
+// VK_EXT_external_memory_dma_buf on both GPUs.
+//
+// The host-staged path moves the same bytes the way software without P2P
+// does: src VRAM -> src readback buffer -> memcpy -> dst upload buffer ->
+// dst VRAM. A direct result no better than the staged one means the peer
+// traffic is bouncing through the CPU rather than crossing the switch.
+
+// Device-local buffer on the current session whose memory is exported as a
+// dma-buf. fd receives a new descriptor owned by the caller (-1 on failure).
+VkBufferAllocation CreateExportedBuffer(VkDeviceSize size, int& fd) {
+    BenchSession& bench = Bench();
+    VkBufferAllocation alloc = {};
+    fd = -1;
+    if (!bench.getMemoryFd) return alloc;
+
+    VkExternalMemoryBufferCreateInfo externalInfo = {};
+    externalInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    externalInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.pNext = &externalInfo;
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VK_CHECK_RETURN(vkCreateBuffer(bench.device, &bufferInfo, nullptr, &alloc.buffer), alloc);
+
+    VkMemoryRequirements memReqs;
+    vkGetBufferMemoryRequirements(bench.device, alloc.buffer, &memReqs);
+    uint32_t memTypeIndex = FindMemoryType(bench.physicalDevice, memReqs.memoryTypeBits,
+                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    VkMemoryDedicatedAllocateInfo dedicatedInfo = {};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.buffer = alloc.buffer;
+    VkExportMemoryAllocateInfo exportInfo = {};
+    exportInfo.sType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+    exportInfo.pNext = &dedicatedInfo;
+    exportInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext = &exportInfo;
+    allocInfo.allocationSize = memReqs.size;
+    allocInfo.memoryTypeIndex = memTypeIndex;
+
+    if (memTypeIndex == UINT32_MAX ||
+        vkAllocateMemory(bench.device, &allocInfo, nullptr, &alloc.memory) != VK_SUCCESS ||
+        vkBindBufferMemory(bench.device, alloc.buffer, alloc.memory, 0) != VK_SUCCESS) {
+        Log("[WARNING] Failed to allocate exportable device memory");
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+
+    VkMemoryGetFdInfoKHR getFdInfo = {};
+    getFdInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+    getFdInfo.memory = alloc.memory;
+    getFdInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+    VkResult result = bench.getMemoryFd(bench.device, &getFdInfo, &fd);
+    if (result != VK_SUCCESS) {
+        Log("[WARNING] vkGetMemoryFdKHR failed: " + std::to_string((int)result));
+        fd = -1;
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+    alloc.size = size;
+    return alloc;
+}
+
+// Buffer on the current session bound to memory imported from a dma-buf.
+// Always takes ownership of fd.
+VkBufferAllocation ImportBuffer(VkDeviceSize size, int fd) {
+    BenchSession& bench = Bench();
+    VkBufferAllocation alloc = {};
+
+    VkMemoryFdPropertiesKHR fdProps = {};
+    fdProps.sType = VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR;
+    if (!bench.getMemoryFdProperties ||
+        bench.getMemoryFdProperties(bench.device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT, fd, &fdProps) != VK_SUCCESS) {
+        Log("[WARNING] dma-buf is not importable on this GPU");
+        close(fd);
+        return alloc;
+    }
+
+    VkExternalMemoryBufferCreateInfo externalInfo = {};
+    externalInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    externalInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.pNext = &externalInfo;
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (vkCreateBuffer(bench.device, &bufferInfo, nullptr, &alloc.buffer) != VK_SUCCESS) {
+        close(fd);
+        alloc.buffer = VK_NULL_HANDLE;
+        return alloc;
+    }
+
+    VkMemoryRequirements memReqs;
+    vkGetBufferMemoryRequirements(bench.device, alloc.buffer, &memReqs);
+    uint32_t memTypeIndex = FindMemoryType(bench.physicalDevice, memReqs.memoryTypeBits & fdProps.memoryTypeBits, 0);
+
+    VkMemoryDedicatedAllocateInfo dedicatedInfo = {};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.buffer = alloc.buffer;
+    VkImportMemoryFdInfoKHR importInfo = {};
+    importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+    importInfo.pNext = &dedicatedInfo;
+    importInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+    importInfo.fd = fd;
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext = &importInfo;
+    allocInfo.allocationSize = memReqs.size;
+    allocInfo.memoryTypeIndex = memTypeIndex;
+
+    // A successful import transfers fd to the driver
+    if (memTypeIndex == UINT32_MAX || vkAllocateMemory(bench.device, &allocInfo, nullptr, &alloc.memory) != VK_SUCCESS) {
+        Log("[WARNING] Failed to import peer dma-buf");
+        close(fd);
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+    if (vkBindBufferMemory(bench.device, alloc.buffer, alloc.memory, 0) != VK_SUCCESS) {
+        alloc.Destroy(bench.device);
+        return alloc;
+    }
+    alloc.size = size;
+    return alloc;
+}
+
+// Average GB/s of `batches` timed submissions of cmd on the current session
+double TimeBenchCommandBuffer(VkCommandBuffer cmd, double bytesPerSubmit, int batches) {
+    if (SubmitAndWait(&cmd, 1) != FenceWaitResult::Success) return 0.0;  // Warm-up
+
+    std::vector<double> bandwidths;
+    for (int i = 0; i < batches && !ShouldAbortBenchmark(); ++i) {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        if (SubmitAndWait(&cmd, 1) != FenceWaitResult::Success) break;
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+        if (seconds > 0) bandwidths.push_back(bytesPerSubmit / (1024.0 * 1024.0 * 1024.0) / seconds);
+    }
+    return bandwidths.empty() ? 0.0 : std::accumulate(bandwidths.begin(), bandwidths.end(), 0.0) / bandwidths.size();
+}
+
+void RunPeerCopyMatrix(const std::vector<int>& gpus) {
+    const size_t n = gpus.size();
+    const int copies = g_app.config.copiesPerBatch;
+    const int batches = std::min(g_app.config.bandwidthBatches, Constants::PEER_COPY_MAX_BATCHES);
+    size_t size = g_app.config.bandwidthSize;
+    for (int gpu : gpus) size = std::min(size, GetSafeMaxBandwidthSize(gpu));
+
+    g_app.currentTest = "Peer Copies";
+    Log("--- GPU-to-GPU copies: " + FormatSize(size) + " between " + std::to_string(n) + " GPUs ---");
+
+    PeerMatrixResult matrix;
+    matrix.gpus = gpus;
+    matrix.direct.assign(n, std::vector<double>(n, 0.0));
+    matrix.staged.assign(n, std::vector<double>(n, 0.0));
+
+    // Every session stays open for the whole matrix; the coordinator thread
+    // switches between them
+    struct PeerGPU {
+        BenchSession       session;
+        bool               ready = false;
+        VkBufferAllocation local, upload, readback;
+        VkCommandBuffer    toReadback = VK_NULL_HANDLE;  // local -> readback
+        VkCommandBuffer    fromUpload = VK_NULL_HANDLE;  // upload -> local
+    };
+    std::vector<PeerGPU> peers(n);
+    auto use = [&](size_t i) { t_benchSession = &peers[i].session; };
+
+    for (size_t i = 0; i < n; ++i) {
+        use(i);
+        PeerGPU& peer = peers[i];
+        peer.session.logPrefix = "[GPU " + std::to_string(gpus[i]) + "] ";
+        peer.session.ownsStatus = false;
+        if (!InitBenchmarkDevice(gpus[i])) continue;
+
+        peer.local = CreateBuffer(VkBufferType::DeviceLocal, size);
+        peer.upload = CreateBuffer(VkBufferType::Upload, size);
+        peer.readback = CreateBuffer(VkBufferType::Readback, size);
+        std::vector<VkCommandBuffer> cmds = AllocateBenchCommandBuffers(2);
+        if (!peer.local || !peer.upload || !peer.readback || cmds.empty()) {
+            Log("[ERROR] Failed to allocate peer copy resources - this GPU sits out");
+            continue;
+        }
+        peer.toReadback = cmds[0];
+        peer.fromUpload = cmds[1];
+        BeginReusableCommandBuffer(peer.toReadback);
+        RecordBenchCopies(peer.toReadback, peer.local.buffer, peer.readback.buffer, size, 1);
+        vkEndCommandBuffer(peer.toReadback);
+        BeginReusableCommandBuffer(peer.fromUpload);
+        RecordBenchCopies(peer.fromUpload, peer.upload.buffer, peer.local.buffer, size, 1);
+        vkEndCommandBuffer(peer.fromUpload);
+        peer.ready = true;
+    }
+
+    for (size_t src = 0; src < n && !ShouldAbortBenchmark(); ++src) {
+        for (size_t dst = 0; dst < n && !ShouldAbortBenchmark(); ++dst) {
+            if (src == dst || !peers[src].ready || !peers[dst].ready) continue;
+
+            // Direct: dst exports, src imports and writes into it
+            use(dst);
+            int fd = -1;
+            VkBufferAllocation exported = CreateExportedBuffer(size, fd);
+            if (exported) {
+                use(src);
+                VkBufferAllocation imported = ImportBuffer(size, fd);
+                if (imported) {
+                    std::vector<VkCommandBuffer> cmd = AllocateBenchCommandBuffers(1);
+                    if (!cmd.empty()) {
+                        BeginReusableCommandBuffer(cmd[0]);
+                        RecordBenchCopies(cmd[0], peers[src].local.buffer, imported.buffer, size, copies);
+                        vkEndCommandBuffer(cmd[0]);
+                        matrix.direct[src][dst] = TimeBenchCommandBuffer(cmd[0], static_cast<double>(size) * copies, batches);
+                        FreeBenchCommandBuffers(cmd);
+                    }
+                }
+                imported.Destroy(Bench().device);
+                use(dst);
+                exported.Destroy(Bench().device);
+            }
+
+            // Host-staged: src VRAM -> host -> dst VRAM, end to end
+            std::vector<double> bandwidths;
+            for (int b = 0; b < batches && !ShouldAbortBenchmark(); ++b) {
+                auto startTime = std::chrono::high_resolution_clock::now();
+                use(src);
+                if (SubmitAndWait(&peers[src].toReadback, 1) != FenceWaitResult::Success) break;
+                InvalidateMappedBuffer(Bench().device, peers[src].readback);
+                memcpy(peers[dst].upload.mappedPtr, peers[src].readback.mappedPtr, size);
+                use(dst);
+                FlushMappedBuffer(Bench().device, peers[dst].upload);
+                if (SubmitAndWait(&peers[dst].fromUpload, 1) != FenceWaitResult::Success) break;
+                double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+                if (seconds > 0) bandwidths.push_back(static_cast<double>(size) / (1024.0 * 1024.0 * 1024.0) / seconds);
+            }
+            if (!bandwidths.empty()) {
+                matrix.staged[src][dst] = std::accumulate(bandwidths.begin(), bandwidths.end(), 0.0) / bandwidths.size();
+            }
+
+            char line[128];
+            snprintf(line, sizeof(line), "  GPU %d -> GPU %d: direct %.2f GB/s, host-staged %.2f GB/s",
+                     gpus[src], gpus[dst], matrix.direct[src][dst], matrix.staged[src][dst]);
+            t_benchSession = nullptr;
+            Log(line);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        use(i);
+        PeerGPU& peer = peers[i];
+        DrainBenchQueue();
+        peer.local.Destroy(Bench().device);
+        peer.upload.Destroy(Bench().device);
+        peer.readback.Destroy(Bench().device);
+        CleanupBenchmarkDevice();  // Frees the command buffers with the pool
+    }
+    t_benchSession = nullptr;
+
+    std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+    g_app.peerMatrix = std::move(matrix);
+}
+
+// ----------------------------------------------------------------------------
+// Concurrent multi-GPU benchmark
+// ----------------------------------------------------------------------------
+// Every selected GPU gets its own BenchSession on its own worker thread.
+// Workers open their device and allocate buffers, then meet at a barrier
+// before each phase (download, upload, bidirectional) so all GPUs stream at
+// once and contend for shared PCIe switches and root ports. Per-GPU numbers
+// are what each GPU sustained under that contention; the aggregate is their
+// sum.
+
+// gpuList indices selected by multiGPUMask
+std::vector<int> SelectedMultiGPUs() {
+    std::vector<int> gpus;
+    for (size_t i = 0; i < g_app.gpuList.size() && i < 64; ++i) {
+        if (!g_app.gpuList[i].isValid) continue;
+        if (g_app.config.multiGPUMask == 0 || (g_app.config.multiGPUMask & (1ull << i)) != 0) {
+            gpus.push_back(static_cast<int>(i));
+        }
+    }
+    return gpus;
+}
+
+void MultiGPUBenchmarkThreadFunc() {
+    g_app.benchmarkThreadRunning = true;
+    g_app.benchmarkStartTime = std::chrono::steady_clock::now();
+    g_app.benchmarkAborted = false;
+
+    const std::vector<int> gpus = SelectedMultiGPUs();
+    const int copies = g_app.config.copiesPerBatch;
+    const int batches = g_app.config.bandwidthBatches;
+    const char* phaseNames[] = { "GPU->CPU", "CPU->GPU", "Bidirectional" };
+    const size_t phaseCount = g_app.config.runBidirectional ? 3 : 2;
+
+    Log("=== Multi-GPU Benchmark Started ===");
+    for (int gpu : gpus) Log("GPU " + std::to_string(gpu) + ": " + g_app.gpuList[gpu].name);
+    Log("Batches: " + std::to_string(batches));
+    Log("Copies/Batch: " + std::to_string(copies));
+    Log("=========================");
+
+    if (gpus.empty()) {
+        Log("[ERROR] No valid GPUs selected for multi-GPU mode");
+        g_app.state = AppState::Idle;
+        g_app.benchmarkThreadRunning = false;
+        return;
+    }
+
+    const bool runPeer = g_app.config.runPeerTest && gpus.size() >= 2;
+    g_app.totalTests = static_cast<int>(phaseCount) + (runPeer ? 1 : 0);
+    g_app.completedTests = 0;
+
+    std::vector<BenchSession> sessions(gpus.size());
+    std::vector<std::vector<BenchmarkResult>> gpuResults(gpus.size(), std::vector<BenchmarkResult>(phaseCount));
+    PhaseBarrier barrier;
+    barrier.participants = gpus.size();
+
+    auto worker = [&](size_t w) {
+        const int gpuIndex = gpus[w];
+        BenchSession& session = sessions[w];
+        session.logPrefix = "[GPU " + std::to_string(gpuIndex) + "] ";
+        session.ownsStatus = false;
+        t_benchSession = &session;
+
+        const size_t size = ValidateBandwidthSize(g_app.config.bandwidthSize, gpuIndex);
+        const bool useRoundTrip = !g_app.gpuList[gpuIndex].isIntegrated;
+
+        VkBufferAllocation cpuUpload, gpuDefault, gpuSrc, cpuReadback;
+        ApplyGPUNumaPlacement(gpuIndex);
+        bool ready = InitBenchmarkDevice(gpuIndex);
+        if (ready) {
+            cpuUpload = CreateBuffer(VkBufferType::Upload, size);
+            gpuDefault = CreateBuffer(VkBufferType::DeviceLocal, size);
+            gpuSrc = CreateBuffer(VkBufferType::DeviceLocal, size);
+            cpuReadback = CreateBuffer(VkBufferType::Readback, size);
+            ready = cpuUpload && gpuDefault && gpuSrc && cpuReadback;
+            if (!ready) Log("[ERROR] Failed to allocate buffers - this GPU sits out");
+        }
+
+        // Every worker arrives at every barrier, even after a failure, so the
+        // others never wait on a GPU that dropped out
+        ArriveAndWait(barrier);  // Start barrier: all devices and buffers ready
+        for (size_t phase = 0; phase < phaseCount; ++phase) {
+            if (w == 0) g_app.currentTest = std::string("All GPUs: ") + phaseNames[phase];
+            if (ready && !ShouldAbortBenchmark()) {
+                std::string name = std::string(phaseNames[phase]) + " " + FormatSize(size);
+                if (phase == 0) {
+                    gpuResults[w][phase] = RunBandwidthTest(name, gpuSrc, cpuReadback, size, copies, batches);
+                } else if (phase == 1) {
+                    gpuResults[w][phase] = RunBandwidthTest(name, cpuUpload, gpuDefault, size, copies, batches,
+                                                            useRoundTrip, gpuResults[w][0].avgValue, &cpuReadback);
+                } else {
+                    gpuResults[w][phase] = RunBidirectionalTest(cpuUpload, gpuDefault, gpuSrc, cpuReadback,
+                                                                size, copies, batches);
+                }
+            }
+            ArriveAndWait(barrier);
+            if (w == 0) {
+                g_app.completedTests++;
+                g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+            }
+        }
+
+        cpuUpload.Destroy(session.device);
+        gpuDefault.Destroy(session.device);
+        gpuSrc.Destroy(session.device);
+        cpuReadback.Destroy(session.device);
+        CleanupBenchmarkDevice();
+        t_benchSession = nullptr;
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t w = 0; w < gpus.size(); ++w) workers.emplace_back(worker, w);
+    for (auto& t : workers) t.join();
+
+    if (runPeer && !ShouldAbortBenchmark()) {
+        RunPeerCopyMatrix(gpus);
+        g_app.completedTests++;
+        g_app.overallProgress = float(g_app.completedTests) / float(g_app.totalTests);
+    }
+
+    // Per-GPU results under contention, then the aggregate per phase
+    std::vector<BenchmarkResult> newResults;
+    for (size_t phase = 0; phase < phaseCount; ++phase) {
+        double aggregate = 0.0;
+        int contributing = 0;
+        for (size_t w = 0; w < gpus.size(); ++w) {
+            BenchmarkResult r = gpuResults[w][phase];
+            if (r.samples.empty()) continue;
+            r.testName = "GPU " + std::to_string(gpus[w]) + " " + r.testName + " (concurrent)";
+            Log("  " + r.testName + ": " + std::to_string(r.avgValue).substr(0, 5) + " GB/s");
+            aggregate += r.avgValue;
+            contributing++;
+            newResults.push_back(std::move(r));
+        }
+        if (contributing == 0) continue;
+
+        BenchmarkResult total;
+        total.testName = std::string("All GPUs ") + phaseNames[phase] + " (" + std::to_string(contributing) + " concurrent)";
+        total.unit = "GB/s";
+        total.minValue = total.avgValue = total.maxValue = aggregate;
+        total.samples.push_back(aggregate);
+        Log("  " + total.testName + ": " + std::to_string(aggregate).substr(0, 5) + " GB/s aggregate");
+        newResults.push_back(std::move(total));
+    }
+
+    if (g_app.cancelRequested) {
+        Log("Benchmark cancelled by user");
+        g_app.state = AppState::Idle;
+    } else if (g_app.benchmarkAborted) {
+        Log("[ERROR] Benchmark aborted due to critical errors");
+        g_app.state = AppState::Idle;
+    } else if (newResults.empty()) {
+        Log("[ERROR] Benchmark failed - no valid bandwidth measurements");
+        g_app.state = AppState::Idle;
+    } else {
+        Log("=== Multi-GPU Benchmark Complete ===");
+        std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+        g_app.results.insert(g_app.results.end(), newResults.begin(), newResults.end());
+        g_app.state = AppState::Completed;
+    }
+
+    g_app.benchmarkThreadRunning = false;
+}
+
 // ============================================================================
 //                             CSV EXPORT
 // ============================================================================
@@ -5158,7 +10492,9 @@ void ExportCSV(const std::string& filename) {
         return;
     }
 
-    file << "Test,Min,Avg,Max,Unit\n";
+    file << "Test,Min,Avg,Max,Unit,CI95 Low,CI95 High";
+    for (const char* label : g_latencyPercentileLabels) file << "," << label;
+    file << "\n";
 
     std::lock_guard<std::mutex> lock(g_app.resultsMutex);
     for (const auto& r : g_app.results) {
@@ -5166,7 +10502,147 @@ void ExportCSV(const std::string& filename) {
             << std::fixed << std::setprecision(2) << r.minValue << ","
             << r.avgValue << ","
             << r.maxValue << ","
-            << r.unit << "\n";
+            << r.unit << ",";
+        if (r.ciHigh > 0) file << r.ciLow << "," << r.ciHigh;
+        else file << ",";
+        if (!r.histogram.empty()) {
+            for (double p : g_latencyPercentiles) file << "," << std::setprecision(3) << r.histogram.Percentile(p);
+        }
+        file << "\n";
+    }
+
+    // Bandwidth vs. transfer size
+    if (!g_app.sizeSweep.empty()) {
+        const SizeSweepResult& sweep = g_app.sizeSweep;
+        file << "\nSize Sweep\n";
+        file << "Size (bytes),CPU->GPU (GB/s),GPU->CPU (GB/s),Bidirectional (GB/s)\n";
+        for (size_t i = 0; i < sweep.sizes.size(); ++i) {
+            file << static_cast<size_t>(sweep.sizes[i]) << ","
+                << std::fixed << std::setprecision(2) << sweep.upload[i] << ","
+                << sweep.download[i] << ","
+                << sweep.bidirectional[i] << "\n";
+        }
+        file << "N1/2 CPU->GPU," << static_cast<size_t>(HalfBandwidthSize(sweep.sizes, sweep.upload)) << " bytes\n";
+        file << "N1/2 GPU->CPU," << static_cast<size_t>(HalfBandwidthSize(sweep.sizes, sweep.download)) << " bytes\n";
+        file << "N1/2 Bidirectional," << static_cast<size_t>(HalfBandwidthSize(sweep.sizes, sweep.bidirectional)) << " bytes\n";
+    }
+
+    // Multi-queue scaling: one row per direction and queue count
+    if (!g_app.queueScaling.empty()) {
+        const QueueScalingResult& scaling = g_app.queueScaling;
+        file << "\nQueue Scaling\n";
+        file << "Direction,Queues,Aggregate (GB/s)";
+        for (const auto& label : scaling.queueLabels) file << "," << label << " (GB/s)";
+        file << "\n";
+        auto writeRows = [&](const char* direction, const std::vector<QueueScalingPoint>& points) {
+            for (const auto& p : points) {
+                file << direction << "," << p.queueCount << ","
+                    << std::fixed << std::setprecision(2) << p.aggregate;
+                for (double bw : p.perQueue) file << "," << bw;
+                file << "\n";
+            }
+        };
+        writeRows("CPU->GPU", scaling.upload);
+        writeRows("GPU->CPU", scaling.download);
+    }
+
+    // GPU x GPU copy matrices: rows = source, columns = destination, 0 = n/a
+    if (!g_app.peerMatrix.empty()) {
+        const PeerMatrixResult& matrix = g_app.peerMatrix;
+        auto writeMatrix = [&](const char* title, const std::vector<std::vector<double>>& values) {
+            file << "\n" << title << " (GB/s)";
+            for (int gpu : matrix.gpus) file << ",GPU " << gpu;
+            file << "\n";
+            for (size_t r = 0; r < matrix.gpus.size(); ++r) {
+                file << "GPU " << matrix.gpus[r];
+                for (double bw : values[r]) file << "," << std::fixed << std::setprecision(2) << bw;
+                file << "\n";
+            }
+        };
+        writeMatrix("Peer Copy Direct", matrix.direct);
+        writeMatrix("Peer Copy Host-Staged", matrix.staged);
+    }
+
+    if (!g_app.computeCopy.empty()) {
+        const ComputeCopyResult& copy = g_app.computeCopy;
+        file << "\nCompute Copy\n";
+        file << "Workgroups,CPU->GPU (GB/s),GPU->CPU (GB/s),GPU->GPU (GB/s)\n";
+        file << std::fixed << std::setprecision(2);
+        file << "DMA," << copy.dmaUpload << "," << copy.dmaDownload << "," << copy.dmaDeviceCopy << "\n";
+        for (const auto& p : copy.points) {
+            file << p.groups << "," << p.upload << "," << p.download << "," << p.deviceCopy << "\n";
+        }
+    }
+
+    if (!g_app.scatterCopy.empty()) {
+        const ScatterCopyResult& scatter = g_app.scatterCopy;
+        file << "\nScatter/Gather Copies\n";
+        file << "Regions," << scatter.regionCount << ",Region Size," << scatter.regionSize
+             << ",Stride," << scatter.stride << ",Order," << (scatter.random ? "random" : "sequential") << "\n";
+        file << "Submission,CPU->GPU (GB/s),CPU->GPU (us/region),GPU->CPU (GB/s),GPU->CPU (us/region)\n";
+        file << std::fixed << std::setprecision(3);
+        file << "1 command," << scatter.uploadBatched.bandwidth << "," << scatter.uploadBatched.perRegionUs << ","
+             << scatter.downloadBatched.bandwidth << "," << scatter.downloadBatched.perRegionUs << "\n";
+        file << "N commands," << scatter.uploadSeparate.bandwidth << "," << scatter.uploadSeparate.perRegionUs << ","
+             << scatter.downloadSeparate.bandwidth << "," << scatter.downloadSeparate.perRegionUs << "\n";
+    }
+
+    if (!g_app.imageCopy.empty()) {
+        const ImageCopyResult& images = g_app.imageCopy;
+        file << "\nImage Copies\n";
+        file << "Format,Tiling,Layout,Bytes,CPU->GPU (GB/s),GPU->CPU (GB/s)\n";
+        file << std::fixed << std::setprecision(2);
+        file << "Buffer,,,," << images.bufferUpload << "," << images.bufferDownload << "\n";
+        for (const auto& p : images.points) {
+            file << p.format << "," << (p.linear ? "linear" : "optimal") << "," << p.layout << ","
+                 << p.bytes << "," << p.upload << "," << p.download << "\n";
+        }
+    }
+
+    if (!g_app.perCopy.empty()) {
+        const PerCopyResult& perCopy = g_app.perCopy;
+        file << "\nPer-Copy Timing (" << FormatSize(perCopy.copySize) << " copies)\n";
+        file << "Direction,First (GB/s),Steady (GB/s),Cold Penalty (us),Within-Batch CV (%),Batches\n";
+        file << std::fixed << std::setprecision(3);
+        file << "CPU->GPU," << perCopy.upload.firstGBps << "," << perCopy.upload.steadyGBps << ","
+             << perCopy.upload.coldPenaltyUs << "," << perCopy.upload.withinBatchCV << "," << perCopy.upload.batches << "\n";
+        file << "GPU->CPU," << perCopy.download.firstGBps << "," << perCopy.download.steadyGBps << ","
+             << perCopy.download.coldPenaltyUs << "," << perCopy.download.withinBatchCV << "," << perCopy.download.batches << "\n";
+        file << "Copy,CPU->GPU (GB/s),GPU->CPU (GB/s)\n";
+        const size_t copyCount = std::max(perCopy.upload.copyGBps.size(), perCopy.download.copyGBps.size());
+        for (size_t k = 0; k < copyCount; ++k) {
+            file << (k + 1) << ",";
+            if (k < perCopy.upload.copyGBps.size()) file << perCopy.upload.copyGBps[k];
+            file << ",";
+            if (k < perCopy.download.copyGBps.size()) file << perCopy.download.copyGBps[k];
+            file << "\n";
+        }
+    }
+
+    if (!g_app.soak.empty()) {
+        const SoakResult& soak = g_app.soak;
+        file << "\nSoak Test\n";
+        file << std::fixed << std::setprecision(3);
+        file << "Traffic," << SoakTrafficName(soak.traffic) << "\n";
+        file << "Duration (s)," << soak.elapsedSeconds << "\n";
+        file << "Mean (GB/s)," << soak.mean << "\n";
+        file << "Min (GB/s)," << soak.min << "\n";
+        file << "Max (GB/s)," << soak.max << "\n";
+        file << "Baseline (GB/s)," << soak.baseline << "\n";
+        file << "Trend (%/h)," << soak.trendPctPerHour << "\n";
+        file << "Time (s),Event\n";
+        for (const auto& e : soak.events) file << e.seconds << "," << e.description << "\n";
+        file << "Time (s),Mean (GB/s),Slowest Second (GB/s)\n";
+        for (const auto& p : soak.series) file << p.seconds << "," << p.gbps << "," << p.minGbps << "\n";
+    }
+
+    if (!g_app.numaComparison.empty()) {
+        const NumaComparisonResult& numa = g_app.numaComparison;
+        file << "\nNUMA Comparison\n";
+        file << "Direction,Local Node " << numa.localNode << " (GB/s),Remote Node " << numa.remoteNode << " (GB/s)\n";
+        file << std::fixed << std::setprecision(2);
+        file << "CPU->GPU," << numa.localUpload << "," << numa.remoteUpload << "\n";
+        file << "GPU->CPU," << numa.localDownload << "," << numa.remoteDownload << "\n";
     }
 
     // Add interface detection info
@@ -5202,6 +10678,11 @@ void ExportCSV(const std::string& filename) {
 //                             GUI RENDERING
 // ============================================================================
 
+// ImPlot tick formatter for byte-size axes
+static int FormatSizeAxisTick(double value, char* buff, int size, void*) {
+    return snprintf(buff, size, "%s", FormatSize(static_cast<size_t>(value)).c_str());
+}
+
 void RenderGUI() {
     // Initialize docking once
     if (!g_app.dockingInitialized) {
@@ -5320,6 +10801,11 @@ void RenderGUI() {
             } else {
                 ImGui::Text("  Type: Discrete GPU");
                 ImGui::Text("  VRAM: %s", FormatMemory(selectedGPU.dedicatedVRAM).c_str());
+                if (selectedGPU.hasReBAR) {
+                    ImGui::Text("  Resizable BAR: Yes (%s CPU-visible)", FormatMemory(selectedGPU.cpuVisibleVRAM).c_str());
+                } else if (selectedGPU.cpuVisibleVRAM > 0) {
+                    ImGui::Text("  Resizable BAR: No (%s window)", FormatMemory(selectedGPU.cpuVisibleVRAM).c_str());
+                }
             }
             
             // PCIe link info
@@ -5436,6 +10922,23 @@ void RenderGUI() {
     ImGui::SetNextItemWidth(-1);
     ImGui::SliderInt("##Runs", &g_app.config.numRuns, 1, 10);
 
+    ImGui::Checkbox("Adaptive Sampling", &g_app.config.adaptiveSampling);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Upload/download tests size their batches to ~%.0f ms and keep sampling\n"
+                         "until the 95%% bootstrap CI of the mean is narrower than the target\n"
+                         "(or the time budget runs out). Batches and Copies per Batch are ignored.\n"
+                         "Outliers (modified z-score > %.1f) are rejected.",
+                         Constants::ADAPTIVE_BATCH_MS, Constants::ADAPTIVE_OUTLIER_Z);
+    }
+    if (g_app.config.adaptiveSampling) {
+        ImGui::Text("Target CI Width");
+        ImGui::SetNextItemWidth(-1);
+        ImGui::SliderFloat("##AdaptiveCI", &g_app.config.adaptiveCIPercent, 0.5f, 10.0f, "%.1f %% of mean");
+        ImGui::Text("Time Budget per Test");
+        ImGui::SetNextItemWidth(-1);
+        ImGui::SliderInt("##AdaptiveBudget", &g_app.config.adaptiveBudgetSec, 5, 120, "%d s");
+    }
+
     ImGui::Spacing();
     ImGui::Checkbox("Run Bidirectional Test", &g_app.config.runBidirectional);
     ImGui::Checkbox("Run Latency Tests", &g_app.config.runLatency);
@@ -5446,6 +10949,153 @@ void RenderGUI() {
                          "On integrated GPUs (APUs), this measures system RAM latency\n"
                          "from the GPU's perspective (includes fabric overhead).");
     }
+    ImGui::Checkbox("Run Size Sweep (4 KB - 1 GB)", &g_app.config.runSizeSweep);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, measures upload, download and bidirectional\n"
+                         "bandwidth at every power-of-two size from 4 KB to 1 GB.\n"
+                         "Plotted as bandwidth vs. transfer size in the Graphs window,\n"
+                         "with N1/2 (size reaching half of peak bandwidth) marked.");
+    }
+    ImGui::Checkbox("Run Queue Scaling Test", &g_app.config.runQueueScaling);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, splits one transfer over 1..N queues at once\n"
+                         "and reports aggregate and per-queue throughput per direction.\n"
+                         "Shows how many copy engines the GPU really exposes.");
+    }
+    if (g_app.config.runQueueScaling) {
+        ImGui::Indent();
+        ImGui::Checkbox("Include Compute/Graphics Queues", &g_app.config.queueScalingAllFamilies);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Also opens every compute and graphics family queue.\n"
+                             "Copies on those queues may run on other engines than DMA.");
+        }
+        ImGui::Unindent();
+    }
+    ImGui::Checkbox("Imported Host Memory", &g_app.config.runHostImport);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Repeats upload, download and latency from application-allocated\n"
+                         "pages imported with VK_EXT_external_memory_host, next to the\n"
+                         "driver-allocated staging results.");
+    }
+    if (g_app.config.runHostImport) {
+        ImGui::Indent();
+        static const char* pageModes[] = { "4 KB pages", "Transparent huge pages", "HugeTLB (MAP_HUGETLB)" };
+        int pageMode = static_cast<int>(g_app.config.hostPageMode);
+        if (ImGui::Combo("Pages##HostPages", &pageMode, pageModes, 3)) {
+            g_app.config.hostPageMode = static_cast<HostPageMode>(pageMode);
+        }
+        ImGui::Unindent();
+    }
+    ImGui::Checkbox("CPU Direct VRAM Access", &g_app.config.runDirectAccess);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, CPU threads write and read mapped VRAM directly\n"
+                         "(plain and streaming stores/loads) - the Resizable BAR upload\n"
+                         "path - and compare it with the DMA copy results.");
+    }
+    ImGui::Checkbox("Compute Copy vs. DMA", &g_app.config.runComputeCopy);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, copies host->VRAM, VRAM->host and VRAM->VRAM with a\n"
+                         "compute shader (uvec4 loads/stores) over a workgroup sweep and\n"
+                         "compares it with the DMA copy engines.");
+    }
+    if (g_app.config.runComputeCopy) {
+        ImGui::Indent();
+        ImGui::SliderInt("Workgroups##ComputeCopy", &g_app.config.computeCopyGroups, 0,
+                         static_cast<int>(Constants::COMPUTE_COPY_MAX_GROUPS), g_app.config.computeCopyGroups == 0 ? "sweep" : "%d",
+                         ImGuiSliderFlags_Logarithmic);
+        ImGui::Unindent();
+    }
+    ImGui::Checkbox("Scatter/Gather Copies", &g_app.config.runScatterCopy);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, copies many small regions between packed staging\n"
+                         "memory and scattered VRAM offsets, as one vkCmdCopyBuffer with N\n"
+                         "regions and as N separate commands, and reports the per-region cost.");
+    }
+    if (g_app.config.runScatterCopy) {
+        ImGui::Indent();
+        ImGui::SliderInt("Regions##Scatter", &g_app.config.scatterRegions, 1, Constants::SCATTER_MAX_REGIONS,
+                         "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::SliderInt("Region Size##Scatter", &g_app.config.scatterRegionSize, 4, Constants::SCATTER_MAX_REGION_SIZE,
+                         "%d B", ImGuiSliderFlags_Logarithmic);
+        ImGui::SliderInt("Stride##Scatter", &g_app.config.scatterStride, 0, Constants::SCATTER_MAX_REGION_SIZE,
+                         g_app.config.scatterStride == 0 ? "packed" : "%d B", ImGuiSliderFlags_Logarithmic);
+        ImGui::Checkbox("Random Offsets##Scatter", &g_app.config.scatterRandom);
+        ImGui::Unindent();
+    }
+    ImGui::Checkbox("Buffer <-> Image Copies", &g_app.config.runImageCopy);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, uploads to and reads back from images (RGBA8, BC7,\n"
+                         "R16F, R32F; optimal and linear tiling; 2D, mip chain and array)\n"
+                         "and compares them with the buffer copy results.");
+    }
+    ImGui::Checkbox("Per-Copy Timing", &g_app.config.runPerCopyTiming);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, puts a timestamp after every copy of a batch and\n"
+                         "compares the first (cold) copy with the steady-state copies.");
+    }
+    ImGui::Checkbox("NUMA-Local Placement", &g_app.config.numaPlacement);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Pins the benchmark and VRAM scan threads to the GPU's local\n"
+                         "CPUs and binds host staging memory to its NUMA node.");
+    }
+    ImGui::Checkbox("Remote NUMA Node Comparison", &g_app.config.runNumaRemote);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After the runs, repeats upload and download with the thread and\n"
+                         "staging memory on another node and reports the cross-socket penalty.");
+    }
+    ImGui::Checkbox("Soak Test", &g_app.config.runSoak);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("After everything else, keeps the link busy for the given time,\n"
+                         "records throughput every second and flags step changes, slow\n"
+                         "degradation and PCIe link changes (throttling, eGPU link drops).");
+    }
+    if (g_app.config.runSoak) {
+        ImGui::Indent();
+        ImGui::SliderInt("Minutes##Soak", &g_app.config.soakMinutes, 1, Constants::SOAK_MAX_MINUTES, "%d min",
+                         ImGuiSliderFlags_Logarithmic);
+        static const char* soakTraffics[] = { "CPU->GPU", "GPU->CPU", "Bidirectional" };
+        int soakTraffic = static_cast<int>(g_app.config.soakTraffic);
+        if (ImGui::Combo("Traffic##Soak", &soakTraffic, soakTraffics, 3)) {
+            g_app.config.soakTraffic = static_cast<SoakTraffic>(soakTraffic);
+        }
+        ImGui::Unindent();
+    }
+    size_t validGPUCount = 0;
+    for (const auto& gpu : g_app.gpuList) validGPUCount += gpu.isValid ? 1 : 0;
+    if (validGPUCount > 1) {
+        ImGui::Checkbox("Multi-GPU Concurrent Mode", &g_app.config.multiGPU);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Runs download, upload and bidirectional on every checked GPU\n"
+                             "at the same time (lockstep, one thread per GPU) and reports\n"
+                             "per-GPU and aggregate bandwidth. Measures contention on\n"
+                             "shared PCIe switches and root ports.");
+        }
+        if (g_app.config.multiGPU) {
+            ImGui::Indent();
+            for (size_t i = 0; i < g_app.gpuList.size() && i < 64; ++i) {
+                if (!g_app.gpuList[i].isValid) continue;
+                const uint64_t bit = 1ull << i;
+                bool checked = g_app.config.multiGPUMask == 0 || (g_app.config.multiGPUMask & bit) != 0;
+                std::string label = std::to_string(i) + ": " + g_app.gpuList[i].name;
+                if (ImGui::Checkbox(label.c_str(), &checked)) {
+                    if (g_app.config.multiGPUMask == 0) {
+                        for (size_t j = 0; j < g_app.gpuList.size() && j < 64; ++j) {
+                            if (g_app.gpuList[j].isValid) g_app.config.multiGPUMask |= 1ull << j;
+                        }
+                    }
+                    g_app.config.multiGPUMask = checked ? (g_app.config.multiGPUMask | bit)
+                                                        : (g_app.config.multiGPUMask & ~bit);
+                }
+            }
+            ImGui::Checkbox("GPU-to-GPU Peer Copies", &g_app.config.runPeerTest);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Copies between every pair of checked GPUs: directly into\n"
+                                 "the other GPU's VRAM (dma-buf import) and bounced through\n"
+                                 "host memory. Shown as a GPU x GPU matrix in the Graphs window.");
+            }
+            ImGui::Unindent();
+        }
+    }
     ImGui::Checkbox("Debug Logging", &g_app.config.debugLogging);
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("Enable verbose diagnostic logging for memory latency test\n"
@@ -5541,7 +11191,7 @@ void RenderGUI() {
             g_app.benchmarkThread.join();
         }
         
-        g_app.benchmarkThread = std::thread(BenchmarkThreadFunc);
+        g_app.benchmarkThread = std::thread(g_app.config.multiGPU ? MultiGPUBenchmarkThreadFunc : BenchmarkThreadFunc);
     }
     if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
         if (g_app.vramTestRunning) {
@@ -5590,6 +11240,15 @@ void RenderGUI() {
     if (ImGui::Button("Clear Charts", ImVec2(-1, 30))) {
         std::lock_guard<std::mutex> lock(g_app.resultsMutex);
         g_app.results.clear();
+        g_app.sizeSweep = SizeSweepResult();
+        g_app.queueScaling = QueueScalingResult();
+        g_app.peerMatrix = PeerMatrixResult();
+        g_app.numaComparison = NumaComparisonResult();
+        g_app.computeCopy = ComputeCopyResult();
+        g_app.scatterCopy = ScatterCopyResult();
+        g_app.imageCopy = ImageCopyResult();
+        g_app.perCopy = PerCopyResult();
+        g_app.soak = SoakResult();
         g_app.uploadBW = 0;
         g_app.downloadBW = 0;
         g_app.uploadPercentage = 0;
@@ -5623,9 +11282,35 @@ void RenderGUI() {
         g_app.config.copiesPerBatch = Constants::DEFAULT_COPIES_PER_BATCH;
         g_app.config.latencyIters = Constants::DEFAULT_LATENCY_ITERS;
         g_app.config.numRuns = Constants::DEFAULT_NUM_RUNS;
+        g_app.config.adaptiveSampling = false;
+        g_app.config.adaptiveCIPercent = static_cast<float>(Constants::DEFAULT_ADAPTIVE_CI_PERCENT);
+        g_app.config.adaptiveBudgetSec = Constants::DEFAULT_ADAPTIVE_BUDGET_SEC;
         g_app.config.runBidirectional = true;
         g_app.config.runLatency = true;
         g_app.config.runMemoryLatency = true;
+        g_app.config.runSizeSweep = false;
+        g_app.config.runQueueScaling = false;
+        g_app.config.queueScalingAllFamilies = false;
+        g_app.config.multiGPU = false;
+        g_app.config.multiGPUMask = 0;
+        g_app.config.runPeerTest = false;
+        g_app.config.runHostImport = false;
+        g_app.config.hostPageMode = HostPageMode::TransparentHuge;
+        g_app.config.runDirectAccess = false;
+        g_app.config.runComputeCopy = false;
+        g_app.config.computeCopyGroups = 0;
+        g_app.config.runScatterCopy = false;
+        g_app.config.scatterRegions = Constants::DEFAULT_SCATTER_REGIONS;
+        g_app.config.scatterRegionSize = Constants::DEFAULT_SCATTER_REGION_SIZE;
+        g_app.config.scatterStride = 0;
+        g_app.config.scatterRandom = false;
+        g_app.config.runImageCopy = false;
+        g_app.config.runPerCopyTiming = false;
+        g_app.config.runSoak = false;
+        g_app.config.soakMinutes = Constants::DEFAULT_SOAK_MINUTES;
+        g_app.config.soakTraffic = SoakTraffic::Bidirectional;
+        g_app.config.numaPlacement = true;
+        g_app.config.runNumaRemote = false;
         g_app.config.quickMode = false;
         g_app.config.averageRuns = true;
         g_app.config.debugLogging = false;
@@ -5664,6 +11349,18 @@ void RenderGUI() {
                              "More thorough but may cause instability.\n"
                              "Use if standard scan passes but you suspect issues.");
         }
+        ImGui::Checkbox("Verify on GPU", &g_app.vramTestGpuVerify);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Write and check patterns with compute shaders in VRAM;\n"
+                             "only mismatches are read back. Much faster than host\n"
+                             "verification, which copies every byte over PCIe twice.");
+        }
+        ImGui::Checkbox("Rotate Chunk Offsets", &g_app.vramTestRotateOffsets);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Start each scan's chunks a quarter chunk further into\n"
+                             "the allocated VRAM than the previous scan, so repeated\n"
+                             "scans write different data to each location.");
+        }
         ImGui::Spacing();
     }
     
@@ -5797,8 +11494,16 @@ void RenderGUI() {
             (int)g_app.completedTests, (int)g_app.totalTests, g_app.overallProgress * 100.0f);
         ImGui::ProgressBar(g_app.overallProgress, ImVec2(-1, 24), overlayBuf);
 
-        // Per-test progress
-        ImGui::ProgressBar(g_app.progress, ImVec2(-1, 24), "Test progress");
+        // Per-test progress; the soak shows its clock and live throughput instead
+        char testBuf[128] = "Test progress";
+        if (g_app.config.runSoak && g_app.currentTest.rfind("Soak", 0) == 0) {
+            std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+            const SoakResult& soak = g_app.soak;
+            snprintf(testBuf, sizeof(testBuf), "Soak %s / %s | %.2f GB/s | %zu event(s)",
+                     FormatDuration(soak.elapsedSeconds).c_str(), FormatDuration(soak.durationSeconds).c_str(),
+                     soak.series.empty() ? 0.0 : soak.series.back().gbps, soak.events.size());
+        }
+        ImGui::ProgressBar(g_app.progress, ImVec2(-1, 24), testBuf);
 
     }
     else if (g_app.state == AppState::Completed) {
@@ -6023,23 +11728,50 @@ void RenderGUI() {
 
         std::lock_guard<std::mutex> lock(g_app.resultsMutex);
 
-        if (ImGui::BeginTable("ResultsTable", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable)) {
+        if (ImGui::BeginTable("ResultsTable", 5 + LATENCY_PERCENTILE_COUNT,
+                              ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable)) {
             ImGui::TableSetupColumn("Test", ImGuiTableColumnFlags_WidthStretch);
             ImGui::TableSetupColumn("Min", ImGuiTableColumnFlags_WidthFixed, 120);
             ImGui::TableSetupColumn("Avg", ImGuiTableColumnFlags_WidthFixed, 120);
             ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthFixed, 120);
+            ImGui::TableSetupColumn("95% CI", ImGuiTableColumnFlags_WidthFixed, 130);
+            for (const char* label : g_latencyPercentileLabels) {
+                ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthFixed, 80);
+            }
             ImGui::TableHeadersRow();
 
             for (const auto& r : g_app.results) {
                 ImGui::TableNextRow();
                 ImGui::TableNextColumn();
                 ImGui::Text("%s", r.testName.c_str());
+                if (r.timeline.samples > 0 && ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Host timeline (calibrated timestamps, %d samples):\n"
+                                      "  submit -> GPU start:     %.1f us\n"
+                                      "  transfer:                %.1f us\n"
+                                      "  GPU end -> CPU wake-up:  %.1f us",
+                                      r.timeline.samples, r.timeline.submitToStartUs,
+                                      r.timeline.transferUs, r.timeline.wakeupUs);
+                }
                 ImGui::TableNextColumn();
                 ImGui::Text("%.2f %s", r.minValue, r.unit.c_str());
                 ImGui::TableNextColumn();
                 ImGui::Text("%.2f %s", r.avgValue, r.unit.c_str());
                 ImGui::TableNextColumn();
                 ImGui::Text("%.2f %s", r.maxValue, r.unit.c_str());
+                ImGui::TableNextColumn();
+                if (r.ciHigh > 0) {
+                    ImGui::Text("%.2f - %.2f", r.ciLow, r.ciHigh);
+                    if (r.rejectedSamples > 0 && ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("%d outlier samples rejected", r.rejectedSamples);
+                    }
+                } else {
+                    ImGui::TextDisabled("-");
+                }
+                for (double p : g_latencyPercentiles) {
+                    ImGui::TableNextColumn();
+                    if (r.histogram.empty()) ImGui::TextDisabled("-");
+                    else ImGui::Text("%.2f", r.histogram.Percentile(p));
+                }
             }
 
             ImGui::EndTable();
@@ -6251,6 +11983,361 @@ void RenderGUI() {
             } else {
                 ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.2f, 1.0f), "  Orange = Best");
             }
+
+            // Latency tail: one line per test across p50 .. p99.99
+            ImGui::Spacing();
+            ImGui::Text("Latency Percentiles (microseconds)");
+            if (ImPlot::BeginPlot("##LatencyPercentiles", ImVec2(-1, 260))) {
+                double ticks[LATENCY_PERCENTILE_COUNT];
+                for (int i = 0; i < LATENCY_PERCENTILE_COUNT; ++i) ticks[i] = static_cast<double>(i);
+                ImPlot::SetupAxes("Percentile", "Microseconds (us)", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupAxisTicks(ImAxis_X1, ticks, LATENCY_PERCENTILE_COUNT, g_latencyPercentileLabels);
+                ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+
+                for (const BenchmarkResult* r : latencyResults) {
+                    if (r->histogram.empty()) continue;
+                    double values[LATENCY_PERCENTILE_COUNT];
+                    for (int i = 0; i < LATENCY_PERCENTILE_COUNT; ++i) values[i] = r->histogram.Percentile(g_latencyPercentiles[i]);
+                    ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 4.0f);
+                    ImPlot::PlotLine(r->testName.c_str(), ticks, values, LATENCY_PERCENTILE_COUNT);
+                }
+                ImPlot::EndPlot();
+            }
+        }
+
+        // Bandwidth vs. transfer size (size sweep)
+        if (!g_app.sizeSweep.empty()) {
+            const SizeSweepResult& sweep = g_app.sizeSweep;
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("Bandwidth vs Transfer Size");
+
+            struct SweepSeries {
+                const char* label;
+                const std::vector<double>* bandwidth;
+                ImVec4 color;
+            };
+            const SweepSeries series[] = {
+                { "CPU->GPU", &sweep.upload, ImVec4(0.2f, 0.6f, 1.0f, 1.0f) },
+                { "GPU->CPU", &sweep.download, ImVec4(0.2f, 0.9f, 0.2f, 1.0f) },
+                { "Bidirectional", &sweep.bidirectional, ImVec4(1.0f, 0.4f, 0.2f, 1.0f) },
+            };
+
+            if (ImPlot::BeginPlot("##SizeSweep", ImVec2(-1, 320))) {
+                ImPlot::SetupAxes("Transfer size", "GB/s", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Log10);
+                ImPlot::SetupAxisFormat(ImAxis_X1, FormatSizeAxisTick, nullptr);
+                ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+
+                for (const auto& s : series) {
+                    // Skip sizes the direction wasn't measured at
+                    std::vector<double> xs, ys;
+                    for (size_t i = 0; i < sweep.sizes.size(); ++i) {
+                        if ((*s.bandwidth)[i] > 0.0) {
+                            xs.push_back(sweep.sizes[i]);
+                            ys.push_back((*s.bandwidth)[i]);
+                        }
+                    }
+                    if (xs.empty()) continue;
+
+                    ImPlot::SetNextLineStyle(s.color);
+                    ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 3.0f, s.color);
+                    ImPlot::PlotLine(s.label, xs.data(), ys.data(), static_cast<int>(xs.size()));
+
+                    double halfSize = HalfBandwidthSize(sweep.sizes, *s.bandwidth);
+                    if (halfSize > 0.0) {
+                        ImPlot::SetNextLineStyle(ImVec4(s.color.x, s.color.y, s.color.z, 0.5f));
+                        ImPlot::PlotInfLines((std::string("##N12 ") + s.label).c_str(), &halfSize, 1);
+                    }
+                }
+                ImPlot::EndPlot();
+            }
+
+            for (const auto& s : series) {
+                double halfSize = HalfBandwidthSize(sweep.sizes, *s.bandwidth);
+                if (halfSize <= 0.0) continue;
+                ImGui::TextColored(s.color, "N1/2 %s: %s", s.label, FormatSize(static_cast<size_t>(halfSize)).c_str());
+            }
+        }
+
+        // Aggregate and mean per-queue bandwidth vs. queue count
+        if (!g_app.queueScaling.empty()) {
+            const QueueScalingResult& scaling = g_app.queueScaling;
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("Bandwidth vs Queue Count");
+
+            struct ScalingSeries {
+                const char* label;
+                const std::vector<QueueScalingPoint>* points;
+                ImVec4 color;
+            };
+            const ScalingSeries series[] = {
+                { "CPU->GPU", &scaling.upload, ImVec4(0.2f, 0.6f, 1.0f, 1.0f) },
+                { "GPU->CPU", &scaling.download, ImVec4(0.2f, 0.9f, 0.2f, 1.0f) },
+            };
+
+            if (ImPlot::BeginPlot("##QueueScaling", ImVec2(-1, 280))) {
+                ImPlot::SetupAxes("Queues", "GB/s", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+
+                for (const auto& s : series) {
+                    if (s.points->empty()) continue;
+                    std::vector<double> xs, aggregate, perQueue;
+                    for (const auto& p : *s.points) {
+                        xs.push_back(p.queueCount);
+                        aggregate.push_back(p.aggregate);
+                        perQueue.push_back(std::accumulate(p.perQueue.begin(), p.perQueue.end(), 0.0) / p.queueCount);
+                    }
+                    int count = static_cast<int>(xs.size());
+                    ImPlot::SetNextLineStyle(s.color);
+                    ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 4.0f, s.color);
+                    ImPlot::PlotLine((std::string(s.label) + " aggregate").c_str(), xs.data(), aggregate.data(), count);
+                    ImPlot::SetNextLineStyle(ImVec4(s.color.x, s.color.y, s.color.z, 0.5f));
+                    ImPlot::SetNextMarkerStyle(ImPlotMarker_Square, 3.0f, s.color);
+                    ImPlot::PlotLine((std::string(s.label) + " per queue").c_str(), xs.data(), perQueue.data(), count);
+                }
+                ImPlot::EndPlot();
+            }
+
+            for (const auto& s : series) {
+                uint32_t saturating = SaturatingQueueCount(*s.points);
+                if (saturating > 0) ImGui::TextColored(s.color, "%s saturates at %u queue(s)", s.label, saturating);
+            }
+        }
+
+        if (!g_app.computeCopy.empty()) {
+            const ComputeCopyResult& copy = g_app.computeCopy;
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("Compute Copy vs. DMA (dashed: DMA)");
+
+            struct CopySeries {
+                const char* label;
+                double ComputeCopyPoint::*value;
+                double dma;
+                ImVec4 color;
+            };
+            const CopySeries series[] = {
+                { "CPU->GPU", &ComputeCopyPoint::upload, copy.dmaUpload, ImVec4(0.2f, 0.6f, 1.0f, 1.0f) },
+                { "GPU->CPU", &ComputeCopyPoint::download, copy.dmaDownload, ImVec4(0.2f, 0.9f, 0.2f, 1.0f) },
+                { "GPU->GPU", &ComputeCopyPoint::deviceCopy, copy.dmaDeviceCopy, ImVec4(1.0f, 0.6f, 0.2f, 1.0f) },
+            };
+
+            if (ImPlot::BeginPlot("##ComputeCopy", ImVec2(-1, 280))) {
+                ImPlot::SetupAxes("Workgroups", "GB/s", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Log10);
+                ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+
+                std::vector<double> xs;
+                for (const auto& p : copy.points) xs.push_back(p.groups);
+                const int count = static_cast<int>(xs.size());
+                for (const auto& s : series) {
+                    std::vector<double> ys;
+                    for (const auto& p : copy.points) ys.push_back(p.*s.value);
+                    ImPlot::SetNextLineStyle(s.color);
+                    ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 4.0f, s.color);
+                    ImPlot::PlotLine(s.label, xs.data(), ys.data(), count);
+                    if (s.dma > 0.0) {
+                        double dmaX[2] = { xs.front(), xs.back() };
+                        double dmaY[2] = { s.dma, s.dma };
+                        ImPlot::SetNextLineStyle(ImVec4(s.color.x, s.color.y, s.color.z, 0.5f));
+                        ImPlot::PlotLine((std::string(s.label) + " DMA").c_str(), dmaX, dmaY, 2);
+                    }
+                }
+                ImPlot::EndPlot();
+            }
+
+            for (const auto& s : series) {
+                uint32_t saturating = SaturatingGroupCount(copy.points, s.value);
+                if (saturating > 0) ImGui::TextColored(s.color, "%s saturates at %u workgroup(s)", s.label, saturating);
+            }
+        }
+
+        if (!g_app.scatterCopy.empty()) {
+            const ScatterCopyResult& scatter = g_app.scatterCopy;
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("Scatter/Gather Copies (%d x %s, stride %s%s)", scatter.regionCount,
+                        FormatSize(scatter.regionSize).c_str(), FormatSize(scatter.stride).c_str(),
+                        scatter.random ? ", random" : "");
+
+            if (ImGui::BeginTable("ScatterCopy", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                ImGui::TableSetupColumn("Submission");
+                ImGui::TableSetupColumn("CPU->GPU GB/s");
+                ImGui::TableSetupColumn("us / region");
+                ImGui::TableSetupColumn("GPU->CPU GB/s");
+                ImGui::TableSetupColumn("us / region");
+                ImGui::TableHeadersRow();
+
+                auto row = [](const char* label, const ScatterCopyTiming& up, const ScatterCopyTiming& down) {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", label);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", up.bandwidth);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", up.perRegionUs);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", down.bandwidth);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", down.perRegionUs);
+                };
+                row("1 command, N regions", scatter.uploadBatched, scatter.downloadBatched);
+                row("N commands", scatter.uploadSeparate, scatter.downloadSeparate);
+                ImGui::EndTable();
+            }
+        }
+
+        if (!g_app.imageCopy.empty()) {
+            const ImageCopyResult& images = g_app.imageCopy;
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("Buffer <-> Image Copies (buffer copies: CPU->GPU %.2f, GPU->CPU %.2f GB/s)",
+                        images.bufferUpload, images.bufferDownload);
+
+            if (ImGui::BeginTable("ImageCopy", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                ImGui::TableSetupColumn("Format");
+                ImGui::TableSetupColumn("Tiling");
+                ImGui::TableSetupColumn("Layout");
+                ImGui::TableSetupColumn("Size");
+                ImGui::TableSetupColumn("CPU->GPU GB/s");
+                ImGui::TableSetupColumn("GPU->CPU GB/s");
+                ImGui::TableHeadersRow();
+
+                auto cell = [](double bw, double reference) {
+                    ImGui::TableNextColumn();
+                    if (reference > 0) ImGui::Text("%.2f (%.0f%%)", bw, bw / reference * 100.0);
+                    else ImGui::Text("%.2f", bw);
+                };
+                for (const auto& p : images.points) {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", p.format.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", p.linear ? "linear" : "optimal");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", p.layout.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%s", FormatSize(p.bytes).c_str());
+                    cell(p.upload, images.bufferUpload);
+                    cell(p.download, images.bufferDownload);
+                }
+                ImGui::EndTable();
+            }
+        }
+
+        if (!g_app.perCopy.empty()) {
+            const PerCopyResult& perCopy = g_app.perCopy;
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("Per-Copy Bandwidth (%s copies, batch-averaged)", FormatSize(perCopy.copySize).c_str());
+            auto summary = [](const char* label, const PerCopyTiming& t) {
+                if (t.batches == 0) return;
+                ImGui::Text("  %s: first copy %.2f GB/s, steady %.2f GB/s (+%.1f us cold), within-batch CV %.1f%%",
+                            label, t.firstGBps, t.steadyGBps, t.coldPenaltyUs, t.withinBatchCV);
+            };
+            summary("CPU->GPU", perCopy.upload);
+            summary("GPU->CPU", perCopy.download);
+
+            if (ImPlot::BeginPlot("##PerCopy", ImVec2(-1, 240))) {
+                ImPlot::SetupAxes("Copy in batch", "GB/s", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupLegend(ImPlotLocation_SouthEast);
+                auto plot = [](const char* label, const PerCopyTiming& t) {
+                    if (t.copyGBps.empty()) return;
+                    std::vector<double> xs(t.copyGBps.size());
+                    for (size_t k = 0; k < xs.size(); ++k) xs[k] = static_cast<double>(k + 1);
+                    ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 4.0f);
+                    ImPlot::PlotLine(label, xs.data(), t.copyGBps.data(), static_cast<int>(xs.size()));
+                };
+                plot("CPU->GPU", perCopy.upload);
+                plot("GPU->CPU", perCopy.download);
+                ImPlot::EndPlot();
+            }
+        }
+
+        if (!g_app.soak.empty()) {
+            const SoakResult& soak = g_app.soak;
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("Soak: %s for %s (mean %.2f GB/s, baseline %.2f, trend %+.2f%%/h, %d s per point)",
+                        SoakTrafficName(soak.traffic), FormatDuration(soak.elapsedSeconds).c_str(),
+                        soak.mean, soak.baseline, soak.trendPctPerHour, soak.bucketSeconds);
+
+            if (ImPlot::BeginPlot("##Soak", ImVec2(-1, 280))) {
+                ImPlot::SetupAxes("Minutes", "GB/s", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                ImPlot::SetupLegend(ImPlotLocation_SouthEast);
+
+                std::vector<double> xs, mean, slowest;
+                for (const auto& p : soak.series) {
+                    xs.push_back(p.seconds / 60.0);
+                    mean.push_back(p.gbps);
+                    slowest.push_back(p.minGbps);
+                }
+                const int count = static_cast<int>(xs.size());
+                ImPlot::SetNextLineStyle(ImVec4(0.2f, 0.6f, 1.0f, 1.0f));
+                ImPlot::PlotLine("Mean", xs.data(), mean.data(), count);
+                ImPlot::SetNextLineStyle(ImVec4(0.2f, 0.6f, 1.0f, 0.4f));
+                ImPlot::PlotLine("Slowest second", xs.data(), slowest.data(), count);
+                if (soak.baseline > 0) {
+                    double baseX[2] = { xs.front(), xs.back() };
+                    double baseY[2] = { soak.baseline, soak.baseline };
+                    ImPlot::SetNextLineStyle(ImVec4(0.6f, 0.6f, 0.6f, 0.8f));
+                    ImPlot::PlotLine("Baseline", baseX, baseY, 2);
+                }
+                std::vector<double> eventXs;
+                for (const auto& e : soak.events) eventXs.push_back(e.seconds / 60.0);
+                if (!eventXs.empty()) {
+                    ImPlot::SetNextLineStyle(ImVec4(1.0f, 0.4f, 0.2f, 0.8f));
+                    ImPlot::PlotInfLines("Events", eventXs.data(), static_cast<int>(eventXs.size()));
+                }
+                ImPlot::EndPlot();
+            }
+
+            for (const auto& e : soak.events) {
+                ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "%s  %s", FormatDuration(e.seconds).c_str(),
+                                   e.description.c_str());
+            }
+        }
+
+        // GPU x GPU copy matrix: rows = source, columns = destination
+        if (!g_app.peerMatrix.empty()) {
+            const PeerMatrixResult& matrix = g_app.peerMatrix;
+            const int n = static_cast<int>(matrix.gpus.size());
+
+            auto drawMatrix = [&](const char* id, const std::vector<std::vector<double>>& values) {
+                if (!ImGui::BeginTable(id, n + 1, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) return;
+                ImGui::TableSetupColumn("src \\ dst");
+                for (int d = 0; d < n; ++d) ImGui::TableSetupColumn(("GPU " + std::to_string(matrix.gpus[d])).c_str());
+                ImGui::TableHeadersRow();
+                for (int r = 0; r < n; ++r) {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("GPU %d", matrix.gpus[r]);
+                    for (int d = 0; d < n; ++d) {
+                        ImGui::TableNextColumn();
+                        if (r == d) ImGui::TextDisabled("-");
+                        else if (values[r][d] <= 0.0) ImGui::TextDisabled("n/a");
+                        else ImGui::Text("%.2f", values[r][d]);
+                    }
+                }
+                ImGui::EndTable();
+            };
+
+            ImGui::Spacing();
+            ImGui::Separator();
+            ImGui::Text("GPU-to-GPU Copies (GB/s, row = source, column = destination)");
+            ImGui::Text("Direct (dma-buf peer)");
+            drawMatrix("PeerDirect", matrix.direct);
+            ImGui::Text("Host-staged");
+            drawMatrix("PeerStaged", matrix.staged);
         }
 
         ImGui::End();
@@ -6916,12 +13003,554 @@ static void GlfwErrorCallback(int error, const char* description) {
     fprintf(stderr, "[GLFW Error %d] %s\n", error, description);
 }
 
+// ============================================================================
+//                     COMMAND LINE / HEADLESS MODE
+// ============================================================================
+// Exit codes (headless):
+//   0 - all requested tests completed (and VRAM scan, if requested, passed)
+//   1 - initialization failure, benchmark failed, or run cancelled
+//   2 - VRAM scan completed but found errors
+//   64 - invalid command line
+
+namespace ExitCode {
+    constexpr int OK            = 0;
+    constexpr int FAILURE       = 1;
+    constexpr int VRAM_ERRORS   = 2;
+    constexpr int USAGE         = 64;
+}
+
+struct CommandLineOptions {
+    bool headless = false;
+    bool showHelp = false;
+    bool listGPUs = false;
+    bool runBenchmark = true;
+    bool runVRAMScan = false;
+    std::string csvPath;
+};
+
+static void PrintUsage(const char* argv0) {
+    printf("Usage: %s [options]\n\n", argv0);
+    printf("Without --headless the GUI starts with the given options as its initial settings.\n\n");
+    printf("  --headless            Run without a window, print the log to stdout and exit\n");
+    printf("  --list-gpus           List Vulkan devices (headless) and exit\n");
+    printf("  --gpu N               Device index from --list-gpus (default 0)\n");
+    printf("  --multi-gpu           Run upload/download/bidirectional on all GPUs at once\n");
+    printf("  --gpus LIST           As --multi-gpu, on the comma-separated --list-gpus indices\n");
+    printf("  --peer                Multi-GPU: also measure the GPU-to-GPU copy matrix\n");
+    printf("  --size MB             Bandwidth transfer size in MB (default %zu)\n", Constants::DEFAULT_BANDWIDTH_SIZE / (1024 * 1024));
+    printf("  --latency-size B      Latency transfer size in bytes (default %zu)\n", Constants::DEFAULT_LATENCY_SIZE);
+    printf("  --batches N           Bandwidth batches (default %d)\n", Constants::DEFAULT_BANDWIDTH_BATCHES);
+    printf("  --copies N            Copies per batch (default %d)\n", Constants::DEFAULT_COPIES_PER_BATCH);
+    printf("  --latency-iters N     Latency iterations (default %d)\n", Constants::DEFAULT_LATENCY_ITERS);
+    printf("  --runs N              Number of runs (default %d)\n", Constants::DEFAULT_NUM_RUNS);
+    printf("  --adaptive            Upload/download: auto-size batches and sample until the 95%% CI converges\n");
+    printf("  --ci-width PCT        Adaptive: target CI width in %% of the mean (default %.1f)\n",
+           Constants::DEFAULT_ADAPTIVE_CI_PERCENT);
+    printf("  --time-budget SEC     Adaptive: time limit per test (default %d)\n", Constants::DEFAULT_ADAPTIVE_BUDGET_SEC);
+    printf("  --quick               Quick mode: 1 run, 16 batches, 500 latency iterations\n");
+    printf("  --no-bidirectional    Skip the bidirectional test\n");
+    printf("  --no-latency          Skip the transfer latency tests\n");
+    printf("  --no-memory-latency   Skip the VRAM pointer-chase latency test\n");
+    printf("  --sweep               Also measure bandwidth at every power of two from 4 KB to 1 GB\n");
+    printf("  --queue-scaling       Also split one transfer over 1..N transfer queues at once\n");
+    printf("  --queue-scaling-all   As --queue-scaling, including compute and graphics queues\n");
+    printf("  --host-import MODE    Also test app-allocated pages via VK_EXT_external_memory_host\n");
+    printf("                        (MODE: 4k, thp or hugetlb)\n");
+    printf("  --direct-access       Also measure CPU writes/reads of mapped VRAM (ReBAR path)\n");
+    printf("  --compute-copy        Also compare compute-shader copies with the DMA engines\n");
+    printf("  --compute-groups N    Workgroups per compute copy dispatch (default: sweep 1..4096)\n");
+    printf("  --scatter N           Also time N-region copies: one command vs. N commands (default 4096)\n");
+    printf("  --scatter-size BYTES  Bytes per scatter region (default 4096)\n");
+    printf("  --scatter-stride BYTES  Bytes between VRAM regions (default: packed)\n");
+    printf("  --scatter-random      Shuffle the VRAM region order\n");
+    printf("  --image-copy          Also time buffer <-> image copies (formats x tilings x layouts)\n");
+    printf("  --per-copy            Also timestamp every copy of a batch (first-copy vs. steady state)\n");
+    printf("  --soak MINUTES        Finish with a sustained soak run, flagging throttling (1-1440)\n");
+    printf("  --soak-traffic MODE   Soak traffic: up, down or bidir (default bidir)\n");
+    printf("  --no-calibrated-timestamps  Time uploads with the round-trip estimate even where\n"
+           "                        VK_EXT_calibrated_timestamps is available\n");
+    printf("  --no-numa             Don't pin threads/host memory to the GPU's NUMA node\n");
+    printf("  --numa-remote         Also measure upload/download from a remote NUMA node\n");
+    printf("  --sysfs-root DIR      Read sysfs from DIR instead of /sys (testing)\n");
+    printf("  --individual-runs     Report each run separately instead of averaging\n");
+    printf("  --debug               Enable debug logging\n");
+    printf("  --vram-scan           Run the VRAM scan (headless: after the benchmark)\n");
+    printf("  --vram-scan-only      Run only the VRAM scan (implies --vram-scan)\n");
+    printf("  --full-scan           VRAM scan covers ~90%% of VRAM instead of ~80%%\n");
+    printf("  --vram-host-verify    Generate/verify VRAM scan patterns on the CPU instead of the GPU\n");
+    printf("  --vram-rotate         Rotate VRAM scan chunk offsets between successive scans (GUI)\n");
+    printf("  --csv FILE            Export results to FILE after the benchmark\n");
+    printf("  -h, --help            Show this help\n\n");
+    printf("Headless exit codes: 0 = OK, 1 = failure/cancelled, 2 = VRAM errors found, 64 = bad arguments\n");
+}
+
+// Parse a bounded integer argument; rejects trailing garbage
+static bool ParseIntArg(const char* text, long minValue, long maxValue, long& out) {
+    if (!text || !*text) return false;
+    char* end = nullptr;
+    errno = 0;
+    long value = strtol(text, &end, 10);
+    if (errno != 0 || end == text || *end != '\0') return false;
+    if (value < minValue || value > maxValue) return false;
+    out = value;
+    return true;
+}
+
+// Parse a bounded floating-point argument; rejects trailing garbage
+static bool ParseDoubleArg(const char* text, double minValue, double maxValue, double& out) {
+    if (!text || !*text) return false;
+    char* end = nullptr;
+    errno = 0;
+    double value = strtod(text, &end);
+    if (errno != 0 || end == text || *end != '\0') return false;
+    if (!(value >= minValue && value <= maxValue)) return false;
+    out = value;
+    return true;
+}
+
+// Fills opts and g_app.config from argv. Returns false on a malformed command line.
+static bool ParseCommandLine(int argc, char* argv[], CommandLineOptions& opts) {
+    BenchmarkConfig& cfg = g_app.config;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        const char* next = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        long value = 0;
+
+        auto needInt = [&](long minValue, long maxValue) -> bool {
+            if (!ParseIntArg(next, minValue, maxValue, value)) {
+                fprintf(stderr, "Invalid or missing value for %s (expected %ld..%ld)\n",
+                        arg.c_str(), minValue, maxValue);
+                return false;
+            }
+            ++i;
+            return true;
+        };
+
+        if (arg == "--headless") {
+            opts.headless = true;
+        } else if (arg == "-h" || arg == "--help") {
+            opts.showHelp = true;
+        } else if (arg == "--list-gpus") {
+            opts.listGPUs = true;
+        } else if (arg == "--gpu") {
+            if (!needInt(0, 63)) return false;
+            cfg.selectedGPU = static_cast<int>(value);
+        } else if (arg == "--multi-gpu") {
+            cfg.multiGPU = true;
+        } else if (arg == "--peer") {
+            cfg.multiGPU = true;
+            cfg.runPeerTest = true;
+        } else if (arg == "--gpus") {
+            std::stringstream list(next ? next : "");
+            std::string item;
+            cfg.multiGPUMask = 0;
+            while (std::getline(list, item, ',')) {
+                long gpu = 0;
+                if (!ParseIntArg(item.c_str(), 0, 63, gpu)) {
+                    fprintf(stderr, "Invalid GPU list for --gpus (expected e.g. 0,2,3)\n");
+                    return false;
+                }
+                cfg.multiGPUMask |= 1ull << gpu;
+            }
+            if (cfg.multiGPUMask == 0) {
+                fprintf(stderr, "Missing GPU list for --gpus\n");
+                return false;
+            }
+            cfg.multiGPU = true;
+            ++i;
+        } else if (arg == "--size") {
+            if (!needInt(static_cast<long>(Constants::MIN_BANDWIDTH_SIZE / (1024 * 1024)), 65536)) return false;
+            cfg.bandwidthSize = static_cast<size_t>(value) * 1024 * 1024;
+        } else if (arg == "--latency-size") {
+            if (!needInt(1, 1024)) return false;
+            cfg.latencySize = static_cast<size_t>(value);
+        } else if (arg == "--batches") {
+            if (!needInt(1, 1024)) return false;
+            cfg.bandwidthBatches = static_cast<int>(value);
+        } else if (arg == "--copies") {
+            if (!needInt(1, 256)) return false;
+            cfg.copiesPerBatch = static_cast<int>(value);
+        } else if (arg == "--latency-iters") {
+            if (!needInt(10, 1000000)) return false;
+            cfg.latencyIters = static_cast<int>(value);
+        } else if (arg == "--runs") {
+            if (!needInt(1, 100)) return false;
+            cfg.numRuns = static_cast<int>(value);
+        } else if (arg == "--adaptive") {
+            cfg.adaptiveSampling = true;
+        } else if (arg == "--ci-width") {
+            double percent = 0;
+            if (!ParseDoubleArg(next, 0.1, 50.0, percent)) {
+                fprintf(stderr, "Invalid or missing value for --ci-width (expected 0.1..50)\n");
+                return false;
+            }
+            cfg.adaptiveCIPercent = static_cast<float>(percent);
+            cfg.adaptiveSampling = true;
+            ++i;
+        } else if (arg == "--time-budget") {
+            if (!needInt(1, Constants::ADAPTIVE_MAX_BUDGET_SEC)) return false;
+            cfg.adaptiveBudgetSec = static_cast<int>(value);
+            cfg.adaptiveSampling = true;
+        } else if (arg == "--quick") {
+            cfg.quickMode = true;
+        } else if (arg == "--no-bidirectional") {
+            cfg.runBidirectional = false;
+        } else if (arg == "--no-latency") {
+            cfg.runLatency = false;
+        } else if (arg == "--no-memory-latency") {
+            cfg.runMemoryLatency = false;
+        } else if (arg == "--sweep") {
+            cfg.runSizeSweep = true;
+        } else if (arg == "--queue-scaling") {
+            cfg.runQueueScaling = true;
+        } else if (arg == "--queue-scaling-all") {
+            cfg.runQueueScaling = true;
+            cfg.queueScalingAllFamilies = true;
+        } else if (arg == "--host-import") {
+            std::string mode = next ? next : "";
+            if (mode == "4k") cfg.hostPageMode = HostPageMode::Normal;
+            else if (mode == "thp") cfg.hostPageMode = HostPageMode::TransparentHuge;
+            else if (mode == "hugetlb") cfg.hostPageMode = HostPageMode::HugeTLB;
+            else {
+                fprintf(stderr, "Invalid page mode for --host-import (expected 4k, thp or hugetlb)\n");
+                return false;
+            }
+            cfg.runHostImport = true;
+            ++i;
+        } else if (arg == "--direct-access") {
+            cfg.runDirectAccess = true;
+        } else if (arg == "--compute-copy") {
+            cfg.runComputeCopy = true;
+        } else if (arg == "--compute-groups") {
+            if (!needInt(1, Constants::COMPUTE_COPY_MAX_GROUPS)) return false;
+            cfg.runComputeCopy = true;
+            cfg.computeCopyGroups = static_cast<int>(value);
+        } else if (arg == "--scatter") {
+            if (!needInt(1, Constants::SCATTER_MAX_REGIONS)) return false;
+            cfg.runScatterCopy = true;
+            cfg.scatterRegions = static_cast<int>(value);
+        } else if (arg == "--scatter-size") {
+            if (!needInt(4, Constants::SCATTER_MAX_REGION_SIZE)) return false;
+            cfg.runScatterCopy = true;
+            cfg.scatterRegionSize = static_cast<int>(value);
+        } else if (arg == "--scatter-stride") {
+            if (!needInt(0, Constants::SCATTER_MAX_REGION_SIZE)) return false;
+            cfg.runScatterCopy = true;
+            cfg.scatterStride = static_cast<int>(value);
+        } else if (arg == "--scatter-random") {
+            cfg.runScatterCopy = true;
+            cfg.scatterRandom = true;
+        } else if (arg == "--image-copy") {
+            cfg.runImageCopy = true;
+        } else if (arg == "--per-copy") {
+            cfg.runPerCopyTiming = true;
+        } else if (arg == "--soak") {
+            if (!needInt(1, Constants::SOAK_MAX_MINUTES)) return false;
+            cfg.runSoak = true;
+            cfg.soakMinutes = static_cast<int>(value);
+        } else if (arg == "--soak-traffic") {
+            std::string mode = next ? next : "";
+            if (mode == "up") cfg.soakTraffic = SoakTraffic::Upload;
+            else if (mode == "down") cfg.soakTraffic = SoakTraffic::Download;
+            else if (mode == "bidir") cfg.soakTraffic = SoakTraffic::Bidirectional;
+            else {
+                fprintf(stderr, "Invalid mode for --soak-traffic (expected up, down or bidir)\n");
+                return false;
+            }
+            cfg.runSoak = true;
+            ++i;
+        } else if (arg == "--no-calibrated-timestamps") {
+            cfg.useCalibratedTimestamps = false;
+        } else if (arg == "--no-numa") {
+            cfg.numaPlacement = false;
+        } else if (arg == "--numa-remote") {
+            cfg.runNumaRemote = true;
+        } else if (arg == "--sysfs-root") {
+            if (!next) {
+                fprintf(stderr, "--sysfs-root requires a directory\n");
+                return false;
+            }
+            g_sysfsRoot = next;
+            ++i;
+        } else if (arg == "--individual-runs") {
+            cfg.averageRuns = false;
+        } else if (arg == "--debug") {
+            cfg.debugLogging = true;
+        } else if (arg == "--vram-scan") {
+            opts.runVRAMScan = true;
+        } else if (arg == "--vram-scan-only") {
+            opts.runVRAMScan = true;
+            opts.runBenchmark = false;
+        } else if (arg == "--full-scan") {
+            g_app.vramTestFullScan = true;
+        } else if (arg == "--vram-host-verify") {
+            g_app.vramTestGpuVerify = false;
+        } else if (arg == "--vram-rotate") {
+            g_app.vramTestRotateOffsets = true;
+        } else if (arg == "--csv") {
+            if (!next) {
+                fprintf(stderr, "Missing file name for --csv\n");
+                return false;
+            }
+            opts.csvPath = next;
+            ++i;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// SIGINT/SIGTERM in headless mode: request a clean cancel so the bench device
+// is torn down by the running test rather than killed mid-submit.
+static void HeadlessSignalHandler(int) {
+    g_app.cancelRequested = true;
+    g_app.vramTestCancelRequested = true;
+}
+
+// Runs the benchmark and/or VRAM scan on the calling thread. No GLFW, no
+// render device, no swapchain - only the Vulkan instance and bench device.
+static int RunHeadless(const CommandLineOptions& opts) {
+    g_app.headless = true;
+    std::signal(SIGINT, HeadlessSignalHandler);
+    std::signal(SIGTERM, HeadlessSignalHandler);
+
+    if (!InitHeadlessVulkan()) {
+        fprintf(stderr, "Failed to create Vulkan instance. Please ensure a Vulkan ICD is installed.\n");
+        return ExitCode::FAILURE;
+    }
+
+    EnumerateGPUs();
+    g_app.systemMemory = DetectSystemMemory();
+    EstimateRatedLatency(g_app.systemMemory);
+
+    if (opts.listGPUs) {
+        for (size_t i = 0; i < g_app.gpuList.size(); ++i) {
+            const GPUInfo& gpu = g_app.gpuList[i];
+            if (!gpu.isValid) {
+                printf("  -  %s\n", gpu.name.c_str());
+                continue;
+            }
+            printf("%3zu  %s %s (%s%s)\n", i, gpu.vendor.c_str(), gpu.name.c_str(),
+                   FormatMemory(gpu.dedicatedVRAM).c_str(), gpu.isIntegrated ? " iGPU" : "");
+        }
+        vkDestroyInstance(g_app.instance, nullptr);
+        g_app.instance = VK_NULL_HANDLE;
+        return ExitCode::OK;
+    }
+
+    int gpuIndex = g_app.config.selectedGPU;
+    if (gpuIndex < 0 || gpuIndex >= static_cast<int>(g_app.gpuList.size()) ||
+        !g_app.gpuList[gpuIndex].isValid) {
+        fprintf(stderr, "GPU index %d is not available (see --list-gpus)\n", gpuIndex);
+        vkDestroyInstance(g_app.instance, nullptr);
+        g_app.instance = VK_NULL_HANDLE;
+        return ExitCode::FAILURE;
+    }
+
+    int exitCode = ExitCode::OK;
+
+    if (opts.runBenchmark) {
+        // Same quick mode overrides as the Start Benchmark button
+        if (g_app.config.quickMode) {
+            g_app.config.numRuns = 1;
+            g_app.config.bandwidthBatches = 16;
+            g_app.config.latencyIters = 500;
+        }
+
+        g_app.state = AppState::Running;
+        g_app.cancelRequested = false;
+        g_app.currentTest = "Initializing...";
+
+        if (g_app.config.multiGPU) {
+            MultiGPUBenchmarkThreadFunc();
+        } else {
+            BenchmarkThreadFunc();
+        }
+
+        if (g_app.state != AppState::Completed) {
+            exitCode = ExitCode::FAILURE;
+        } else {
+            std::lock_guard<std::mutex> lock(g_app.resultsMutex);
+            printf("\n%-36s %12s %12s %12s  %s\n", "Test", "Min", "Avg", "Max", "Unit");
+            for (const auto& r : g_app.results) {
+                printf("%-36s %12.3f %12.3f %12.3f  %s", r.testName.c_str(),
+                       r.minValue, r.avgValue, r.maxValue, r.unit.c_str());
+                if (r.ciHigh > 0) printf("  (95%% CI %.3f - %.3f)", r.ciLow, r.ciHigh);
+                printf("\n");
+            }
+            bool timelineHeader = false;
+            for (const auto& r : g_app.results) {
+                if (r.timeline.samples == 0) continue;
+                if (!timelineHeader) {
+                    printf("\n%-36s %14s %12s %14s\n", "Host timeline (us)", "Submit->Start", "Transfer", "End->Wake-up");
+                    timelineHeader = true;
+                }
+                printf("%-36s %14.1f %12.1f %14.1f\n", r.testName.c_str(),
+                       r.timeline.submitToStartUs, r.timeline.transferUs, r.timeline.wakeupUs);
+            }
+            bool percentileHeader = false;
+            for (const auto& r : g_app.results) {
+                if (r.histogram.empty()) continue;
+                if (!percentileHeader) {
+                    printf("\n%-36s", "Latency percentiles");
+                    for (const char* label : g_latencyPercentileLabels) printf(" %10s", label);
+                    printf("\n");
+                    percentileHeader = true;
+                }
+                printf("%-36s", r.testName.c_str());
+                for (double p : g_latencyPercentiles) printf(" %10.3f", r.histogram.Percentile(p));
+                printf("  %s\n", r.unit.c_str());
+            }
+            if (!g_app.sizeSweep.empty()) {
+                const SizeSweepResult& sweep = g_app.sizeSweep;
+                printf("\n%-12s %12s %12s %12s  (GB/s)\n", "Size", "CPU->GPU", "GPU->CPU", "Bidir");
+                for (size_t i = 0; i < sweep.sizes.size(); ++i) {
+                    printf("%-12s %12.3f %12.3f %12.3f\n", FormatSize(static_cast<size_t>(sweep.sizes[i])).c_str(),
+                           sweep.upload[i], sweep.download[i], sweep.bidirectional[i]);
+                }
+                printf("%-12s %12s %12s %12s\n", "N1/2",
+                       FormatSize(static_cast<size_t>(HalfBandwidthSize(sweep.sizes, sweep.upload))).c_str(),
+                       FormatSize(static_cast<size_t>(HalfBandwidthSize(sweep.sizes, sweep.download))).c_str(),
+                       FormatSize(static_cast<size_t>(HalfBandwidthSize(sweep.sizes, sweep.bidirectional))).c_str());
+            }
+            if (!g_app.queueScaling.empty()) {
+                const QueueScalingResult& scaling = g_app.queueScaling;
+                printf("\n%-10s %6s %12s  per queue (GB/s)\n", "Direction", "Queues", "Aggregate");
+                auto printRows = [&](const char* direction, const std::vector<QueueScalingPoint>& points) {
+                    for (const auto& p : points) {
+                        printf("%-10s %6u %12.3f ", direction, p.queueCount, p.aggregate);
+                        for (size_t i = 0; i < p.perQueue.size(); ++i) {
+                            printf(" %s=%.2f", scaling.queueLabels[i].c_str(), p.perQueue[i]);
+                        }
+                        printf("\n");
+                    }
+                };
+                printRows("CPU->GPU", scaling.upload);
+                printRows("GPU->CPU", scaling.download);
+            }
+            if (!g_app.peerMatrix.empty()) {
+                const PeerMatrixResult& matrix = g_app.peerMatrix;
+                auto printMatrix = [&](const char* title, const std::vector<std::vector<double>>& values) {
+                    printf("\n%-16s", title);
+                    for (int gpu : matrix.gpus) printf(" %9s%-3d", "GPU ", gpu);
+                    printf("\n");
+                    for (size_t r = 0; r < matrix.gpus.size(); ++r) {
+                        printf("GPU %-12d", matrix.gpus[r]);
+                        for (double bw : values[r]) printf(" %12.3f", bw);
+                        printf("\n");
+                    }
+                };
+                printMatrix("Peer direct", matrix.direct);
+                printMatrix("Peer staged", matrix.staged);
+            }
+            if (!g_app.computeCopy.empty()) {
+                const ComputeCopyResult& copy = g_app.computeCopy;
+                printf("\n%-12s %12s %12s %12s  (GB/s)\n", "Workgroups", "CPU->GPU", "GPU->CPU", "GPU->GPU");
+                printf("%-12s %12.3f %12.3f %12.3f\n", "DMA", copy.dmaUpload, copy.dmaDownload, copy.dmaDeviceCopy);
+                for (const auto& p : copy.points) {
+                    printf("%-12u %12.3f %12.3f %12.3f\n", p.groups, p.upload, p.download, p.deviceCopy);
+                }
+            }
+            if (!g_app.scatterCopy.empty()) {
+                const ScatterCopyResult& scatter = g_app.scatterCopy;
+                printf("\nScatter %d x %zu B (stride %zu%s)\n", scatter.regionCount, scatter.regionSize,
+                       scatter.stride, scatter.random ? ", random" : "");
+                printf("%-12s %12s %12s %12s %12s\n", "Submission", "CPU->GPU", "us/region", "GPU->CPU", "us/region");
+                printf("%-12s %12.3f %12.3f %12.3f %12.3f\n", "1 command",
+                       scatter.uploadBatched.bandwidth, scatter.uploadBatched.perRegionUs,
+                       scatter.downloadBatched.bandwidth, scatter.downloadBatched.perRegionUs);
+                printf("%-12s %12.3f %12.3f %12.3f %12.3f\n", "N commands",
+                       scatter.uploadSeparate.bandwidth, scatter.uploadSeparate.perRegionUs,
+                       scatter.downloadSeparate.bandwidth, scatter.downloadSeparate.perRegionUs);
+            }
+            if (!g_app.imageCopy.empty()) {
+                const ImageCopyResult& images = g_app.imageCopy;
+                printf("\n%-24s %12s %12s  (GB/s)\n", "Image copy", "CPU->GPU", "GPU->CPU");
+                printf("%-24s %12.3f %12.3f\n", "buffer", images.bufferUpload, images.bufferDownload);
+                for (const auto& p : images.points) {
+                    std::string label = p.format + (p.linear ? " linear " : " optimal ") + p.layout;
+                    printf("%-24s %12.3f %12.3f\n", label.c_str(), p.upload, p.download);
+                }
+            }
+            if (!g_app.perCopy.empty()) {
+                const PerCopyResult& perCopy = g_app.perCopy;
+                printf("\n%-12s %12s %12s %14s %10s  (%s copies)\n", "Per-copy", "First GB/s", "Steady GB/s",
+                       "Cold penalty", "CV %", FormatSize(perCopy.copySize).c_str());
+                printf("%-12s %12.3f %12.3f %11.1f us %10.1f\n", "CPU->GPU", perCopy.upload.firstGBps,
+                       perCopy.upload.steadyGBps, perCopy.upload.coldPenaltyUs, perCopy.upload.withinBatchCV);
+                printf("%-12s %12.3f %12.3f %11.1f us %10.1f\n", "GPU->CPU", perCopy.download.firstGBps,
+                       perCopy.download.steadyGBps, perCopy.download.coldPenaltyUs, perCopy.download.withinBatchCV);
+            }
+            if (!g_app.soak.empty()) {
+                const SoakResult& soak = g_app.soak;
+                printf("\nSoak %s for %s: mean %.3f GB/s (min %.3f, max %.3f), baseline %.3f, trend %+.2f%%/h\n",
+                       SoakTrafficName(soak.traffic), FormatDuration(soak.elapsedSeconds).c_str(),
+                       soak.mean, soak.min, soak.max, soak.baseline, soak.trendPctPerHour);
+                for (const auto& e : soak.events) {
+                    printf("  %s  %s\n", FormatDuration(e.seconds).c_str(), e.description.c_str());
+                }
+            }
+            if (!g_app.numaComparison.empty()) {
+                const NumaComparisonResult& numa = g_app.numaComparison;
+                printf("\n%-12s %14s %14s  (GB/s)\n", "NUMA",
+                       ("node " + std::to_string(numa.localNode)).c_str(),
+                       ("node " + std::to_string(numa.remoteNode)).c_str());
+                printf("%-12s %14.3f %14.3f\n", "CPU->GPU", numa.localUpload, numa.remoteUpload);
+                printf("%-12s %14.3f %14.3f\n", "GPU->CPU", numa.localDownload, numa.remoteDownload);
+            }
+            printf("\n");
+            fflush(stdout);
+        }
+
+        if (exitCode == ExitCode::OK && !opts.csvPath.empty()) {
+            ExportCSV(opts.csvPath);
+        }
+    }
+
+    if (opts.runVRAMScan && exitCode == ExitCode::OK && !g_app.cancelRequested) {
+        if (g_app.gpuList[gpuIndex].isIntegrated) {
+            Log("[INFO] VRAM scan skipped: integrated GPU uses shared system memory");
+        } else {
+            g_app.vramTestCancelRequested = false;
+            g_app.vramTestRunning = true;
+            g_app.vramTestProgress = 0.0f;
+
+            VRAMTestThreadFunc();
+
+            if (!g_app.vramTestResult.completed) {
+                exitCode = ExitCode::FAILURE;
+            } else if (g_app.vramTestResult.totalErrors > 0) {
+                exitCode = ExitCode::VRAM_ERRORS;
+            }
+        }
+    }
+
+    CleanupBenchmarkDevice();
+    vkDestroyInstance(g_app.instance, nullptr);
+    g_app.instance = VK_NULL_HANDLE;
+    return exitCode;
+}
+
 // ============================================================================
 //                              MAIN
 // ============================================================================
 
 int main(int argc, char* argv[]) {
-    (void)argc; (void)argv;
+    CommandLineOptions opts;
+    if (!ParseCommandLine(argc, argv, opts)) {
+        PrintUsage(argv[0]);
+        return ExitCode::USAGE;
+    }
+    if (opts.showHelp) {
+        PrintUsage(argv[0]);
+        return ExitCode::OK;
+    }
+    if (opts.headless || opts.listGPUs) {
+        return RunHeadless(opts);
+    }
 
     // Initialize GLFW
     glfwSetErrorCallback(GlfwErrorCallback);
@@ -6968,6 +13597,9 @@ int main(int argc, char* argv[]) {
 
     // Enumerate GPUs
     EnumerateGPUs();
+    if (g_app.config.selectedGPU >= static_cast<int>(g_app.gpuList.size())) {
+        g_app.config.selectedGPU = 0;  // --gpu index out of range for this system
+    }
 
     // Detect system memory early
     g_app.systemMemory = DetectSystemMemory();